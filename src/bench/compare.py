@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# libnimble
+# Copyright (C) 2015 David Jolly
+# ----------------------
+#
+# libnimble is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# libnimble is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+import argparse
+import json
+import sys
+
+ALLOC_SLACK = 0.01
+THROUGHPUT_THRESHOLD = 0.10
+
+def load(path):
+	with open(path) as source:
+		return dict((entry['name'], entry) for entry in json.load(source)['results'])
+
+def compare(baseline, current, threshold):
+	regressions = 0
+
+	print('%-40s %14s %14s %9s %10s %10s' % ('name', 'base ops/s', 'ops/s', 'delta',
+		'base a/op', 'a/op'))
+
+	for name in sorted(current):
+		if name not in baseline:
+			continue
+
+		base, cur = baseline[name], current[name]
+		flags = []
+		delta = ''
+
+		if ('ops_per_sec' in base) and ('ops_per_sec' in cur) and base['ops_per_sec']:
+			ratio = (cur['ops_per_sec'] / float(base['ops_per_sec'])) - 1.0
+			delta = '%+8.1f%%' % (ratio * 100.0)
+
+			if ratio < -threshold:
+				flags.append('SLOWER')
+
+		if ('allocs_per_op' in base) and ('allocs_per_op' in cur) \
+				and (cur['allocs_per_op'] > (base['allocs_per_op'] + ALLOC_SLACK)):
+			flags.append('ALLOCS')
+
+		if ('latency_us' in base) and ('latency_us' in cur) and base['latency_us']['p50'] \
+				and (cur['latency_us']['p50'] > (base['latency_us']['p50'] * (1.0 + threshold))):
+			flags.append('LATENCY')
+
+		if ('bytes' in base) and ('bytes' in cur) and (cur['bytes'] > base['bytes']):
+			flags.append('SIZE')
+
+		print('%-40s %14s %14s %9s %10s %10s %s' % (name[:40], base.get('ops_per_sec', ''),
+			cur.get('ops_per_sec', ''), delta, base.get('allocs_per_op', ''),
+			cur.get('allocs_per_op', ''), ' '.join(flags)))
+
+		if flags:
+			regressions += 1
+
+	for name in sorted(set(baseline) - set(current)):
+		print('%-40s missing from current run' % name[:40])
+
+	print('%d regression(s), threshold %.1f%%' % (regressions, threshold * 100.0))
+
+	return regressions
+
+def main():
+	parser = argparse.ArgumentParser(description='Compare nimble_bench JSON output against a baseline')
+	parser.add_argument('baseline')
+	parser.add_argument('current')
+	parser.add_argument('-t', '--threshold', type=float, default=THROUGHPUT_THRESHOLD,
+		help='allowed fractional throughput drop (default %.2f)' % THROUGHPUT_THRESHOLD)
+	arguments = parser.parse_args()
+
+	return 1 if compare(load(arguments.baseline), load(arguments.current),
+		arguments.threshold) else 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,1555 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include "../lib/include/nimble.h"
+
+#define BENCH_ALLOC_RESET() bench_alloc_count.store(0)
+#define BENCH_ENV_COUNT 10000
+#define BENCH_ENV_PREFIX "NIMBLE_BENCH_"
+#define BENCH_ENV_ROUNDS 100
+#define BENCH_ENV_VALUE "/usr/local/share/nimble/bench"
+#define BENCH_FACTORY_COUNT 100000
+#define BENCH_FACTORY_ROUNDS 10
+#define BENCH_FLAG_JSON "-j"
+#define BENCH_FLAG_SHELL "-s"
+#define BENCH_GENERATE_ASSIGN_LINES 2000
+#define BENCH_GENERATE_LINES 5000
+#define BENCH_GENERATE_NAMES 64
+#define BENCH_GENERATE_SEED 0x6e696d626c65ULL
+#define BENCH_LEXER_ROUNDS 10
+#define BENCH_MOVE_CHILDREN 4
+#define BENCH_MOVE_COUNT 100000
+#define BENCH_MOVE_TEXT "/usr/local/share/nimble/bench/command --argument"
+#define BENCH_NODE_ROUNDS 1000
+#define BENCH_OBJECT_COUNT 100000
+#define BENCH_OBJECT_ROUNDS 10
+#define BENCH_PARSE_ASSIGN "$NIMBLE_BENCH = \"value\""
+#define BENCH_PARSE_LINE "$NIMBLE_BENCH = \"value\" ; /bin/echo $NIMBLE_BENCH arg0 arg1"
+#define BENCH_PARSE_LINES 2000
+#define BENCH_PARSE_SEPARATOR " ; "
+#define BENCH_RCU_CHURN (ENV_RCU_READERS * 4)
+#define BENCH_RCU_CHURN_READS 100
+#define BENCH_RCU_CHURN_WAVE (ENV_RCU_READERS / 2)
+#define BENCH_RCU_COUNT 1000
+#define BENCH_RCU_READS 1000000
+#define BENCH_RCU_READERS_MAX 8
+#define BENCH_RCU_WRITERS 2
+#define BENCH_SHELL_ARGUMENTS 256
+#define BENCH_SHELL_COMMANDS 500
+#define BENCH_SHELL_DEPTH 16
+#define BENCH_SHELL_ENV_COUNT 4096
+#define BENCH_SHELL_EXIT "exit"
+#define BENCH_SHELL_IMAGE "/proc/self/exe"
+#define BENCH_SHELL_PROMPT " -> "
+#define BENCH_SHELL_READ 0x1000
+#define BENCH_SHELL_TRUE "/bin/true"
+#define BENCH_SIZE(_TYPE_) bench_report_size(#_TYPE_, sizeof(_TYPE_))
+#define BENCH_STATS_OPERATIONS 10000000
+#define BENCH_TRACE_DIRECTORY "/tmp/nimble_bench_XXXXXX"
+#define BENCH_TRACE_ENABLED_BATCH (TRACE_RING_SLOTS / 2)
+#define BENCH_TRACE_ENABLED_OPERATIONS 1000000
+#define BENCH_TRACE_OPERATIONS 100000000
+#define BENCH_TRACE_OUTPUT "trace"
+#define BENCH_UID_OPERATIONS 10000000
+#define BENCH_UID_WINDOW 0x400
+#define BENCH_USAGE_USEC(_TIME_) (((_TIME_).tv_sec * 1000000L) + (_TIME_).tv_usec)
+
+typedef std::chrono::high_resolution_clock nimble_bench_clock;
+
+typedef void (*nimble_bench_cb)(void);
+
+typedef std::string (*nimble_bench_shell_cb)(size_t);
+
+typedef struct {
+	size_t allocs;
+	size_t bytes;
+	double elapsed;
+	bool has_alloc;
+	bool has_latency;
+	bool has_size;
+	bool has_time;
+	bool has_usage;
+	double latency_max;
+	double latency_p50;
+	double latency_p90;
+	double latency_p99;
+	size_t operations;
+	struct rusage usage_children;
+	struct rusage usage_self;
+} nimble_bench_record;
+
+static std::atomic<size_t> bench_alloc_count(0);
+
+static bool bench_failed = false;
+
+static bool bench_json = false;
+
+static int bench_shell_usage = INVALID_TYPE(int);
+
+static std::streambuf *bench_stdout = NULL;
+
+static std::vector<std::pair<std::string, nimble_bench_record>> bench_record;
+
+static const std::string BENCH_NODE_EXAMPLE[] = {
+	"$a=10", "$a=$b", "a b c", "a b; c",
+	};
+
+#define BENCH_NODE_EXAMPLE_COUNT (sizeof(BENCH_NODE_EXAMPLE) / sizeof(BENCH_NODE_EXAMPLE[0]))
+
+void *
+operator new(
+	__in size_t size
+	)
+{
+	void *result = NULL;
+
+	bench_alloc_count.fetch_add(1, std::memory_order_relaxed);
+
+	result = std::malloc(size ? size : 1);
+	if(!result) {
+		throw std::bad_alloc();
+	}
+
+	return result;
+}
+
+void 
+operator delete(
+	__in void *pointer
+	) noexcept
+{
+	std::free(pointer);
+}
+
+nimble_bench_record &
+bench_record_find(
+	__in const std::string &name
+	)
+{
+	size_t iter;
+	nimble_bench_record record = { };
+	nimble_bench_record *result = NULL;
+
+	for(iter = 0; iter < bench_record.size(); ++iter) {
+
+		if(bench_record.at(iter).first == name) {
+			result = &bench_record.at(iter).second;
+			break;
+		}
+	}
+
+	if(!result) {
+		bench_record.push_back(std::pair<std::string, nimble_bench_record>(name, record));
+		result = &bench_record.back().second;
+	}
+
+	return *result;
+}
+
+std::string 
+bench_record_as_json(void)
+{
+	size_t iter;
+	std::stringstream result;
+
+	result << "{\"version\":\"" << nimble::version() << "\",\"threaded\":"
+#ifdef NIMBLE_THREADED
+		<< "true"
+#else
+		<< "false"
+#endif // NIMBLE_THREADED
+		<< ",\"results\":[";
+
+	for(iter = 0; iter < bench_record.size(); ++iter) {
+		nimble_bench_record &record = bench_record.at(iter).second;
+
+		result << (iter ? ",\n" : "\n") << "{\"name\":\"";
+
+		for(std::string::const_iterator ch = bench_record.at(iter).first.begin(); 
+				ch != bench_record.at(iter).first.end(); ++ch) {
+
+			if((*ch == '\"') || (*ch == '\\')) {
+				result << '\\';
+			}
+
+			result << *ch;
+		}
+
+		result << "\"";
+
+		if(record.has_time) {
+			result << ",\"operations\":" << record.operations << ",\"ms\":" << std::fixed 
+				<< std::setprecision(3) << (record.elapsed * 1000.0) << ",\"ops_per_sec\":" 
+				<< std::setprecision(0) << (record.elapsed 
+					? (record.operations / record.elapsed) : 0.0);
+		}
+
+		if(record.has_alloc) {
+			result << ",\"allocs\":" << record.allocs << ",\"allocs_per_op\":" << std::fixed 
+				<< std::setprecision(3) << (record.operations 
+					? (record.allocs / (double) record.operations) : 0.0);
+		}
+
+		if(record.has_size) {
+			result << ",\"bytes\":" << record.bytes;
+		}
+
+		if(record.has_latency) {
+			result << ",\"latency_us\":{\"p50\":" << std::fixed << std::setprecision(3) 
+				<< record.latency_p50 << ",\"p90\":" << record.latency_p90 << ",\"p99\":" 
+				<< record.latency_p99 << ",\"max\":" << record.latency_max << "}";
+		}
+
+		if(record.has_usage) {
+			result << ",\"shell_user_us\":" << BENCH_USAGE_USEC(record.usage_self.ru_utime)
+				<< ",\"shell_sys_us\":" << BENCH_USAGE_USEC(record.usage_self.ru_stime)
+				<< ",\"shell_maxrss_kb\":" << record.usage_self.ru_maxrss
+				<< ",\"child_user_us\":" << BENCH_USAGE_USEC(record.usage_children.ru_utime)
+				<< ",\"child_sys_us\":" << BENCH_USAGE_USEC(record.usage_children.ru_stime);
+		}
+
+		result << "}";
+	}
+
+	result << "\n]}";
+
+	return result.str();
+}
+
+void 
+bench_report_alloc(
+	__in const std::string &name,
+	__in size_t operations
+	)
+{
+	size_t count = bench_alloc_count.load();
+	nimble_bench_record &record = bench_record_find(name);
+
+	record.allocs = count;
+	record.has_alloc = true;
+	record.operations = operations;
+
+	std::cout << std::left << std::setw(32) << name << std::right << std::setw(12) 
+		<< count << " allocs " << std::fixed << std::setprecision(3) << std::setw(10) 
+		<< (operations ? (count / (double) operations) : 0.0) << " allocs/op" << std::endl;
+}
+
+void 
+bench_report(
+	__in const std::string &name,
+	__in size_t operations,
+	__in const nimble_bench_clock::time_point &begin,
+	__in const nimble_bench_clock::time_point &end
+	)
+{
+	double elapsed;
+	nimble_bench_record &record = bench_record_find(name);
+
+	elapsed = std::chrono::duration<double>(end - begin).count();
+	record.elapsed = elapsed;
+	record.has_time = true;
+	record.operations = operations;
+	std::cout << std::left << std::setw(32) << name << std::right << std::setw(12) 
+		<< operations << " ops " << std::fixed << std::setprecision(3) << std::setw(10) 
+		<< (elapsed * 1000.0) << " ms " << std::setprecision(0) << std::setw(14) 
+		<< (elapsed ? (operations / elapsed) : 0.0) << " ops/s" << std::endl;
+}
+
+void 
+bench_report_size(
+	__in const std::string &name,
+	__in size_t size
+	)
+{
+	nimble_bench_record &record = bench_record_find(name);
+
+	record.bytes = size;
+	record.has_size = true;
+	std::cout << std::left << std::setw(32) << name << std::right << std::setw(12) 
+		<< size << " bytes" << std::endl;
+}
+
+std::string 
+bench_generate(
+	__in size_t lines,
+	__in_opt bool assign = false,
+	__in_opt uint64_t seed = BENCH_GENERATE_SEED
+	)
+{
+	size_t iter, name;
+	std::stringstream result;
+
+	for(iter = 0; iter < lines; ++iter) {
+		seed = ((seed * 6364136223846793005ULL) + 1442695040888963407ULL);
+		name = ((seed >> 33) % BENCH_GENERATE_NAMES);
+
+		if(iter) {
+			result << BENCH_PARSE_SEPARATOR;
+		}
+
+		switch((seed >> 17) % (assign ? 2 : 4)) {
+			case 0:
+				result << "$" << BENCH_ENV_PREFIX << name << " = \"value " << iter << "\"";
+				break;
+			case 1:
+				result << "$" << BENCH_ENV_PREFIX << name << " = $" << BENCH_ENV_PREFIX 
+					<< ((name * 7919) % BENCH_GENERATE_NAMES);
+				break;
+			case 2:
+				result << "/bin/echo $" << BENCH_ENV_PREFIX << name << " arg0 \"arg " << iter 
+					<< "\"";
+				break;
+			default:
+				result << "( /bin/echo nested $" << BENCH_ENV_PREFIX << name << " )";
+				break;
+		}
+	}
+
+	return result.str();
+}
+
+void 
+bench_environment_expand(void)
+{
+	size_t count = 0;
+	std::string value;
+	std::stringstream input;
+	nimble_ptr inst = NULL;
+	size_t iter, round, result = 0;
+	nimble_bench_clock::time_point begin;
+	std::map<std::string, std::string> reference;
+	std::vector<std::pair<std::string, uint32_t>> field;
+
+	inst = nimble::acquire();
+	inst->initialize();
+
+	for(iter = 0; iter < BENCH_ENV_COUNT; ++iter) {
+		std::stringstream name;
+
+		name << BENCH_ENV_PREFIX << iter;
+		inst->environment_set(name.str(), BENCH_ENV_VALUE);
+		reference.insert(std::pair<std::string, std::string>(name.str(), BENCH_ENV_VALUE));
+		input << CHAR_SPACE << "$" << BENCH_ENV_PREFIX << ((iter * 7919) % BENCH_ENV_COUNT);
+	}
+
+	begin = nimble_bench_clock::now();
+	nimble_lexer lex(input.str());
+
+	while(lex.has_next_token()) {
+		nimble_token &tok = lex.move_next_token();
+
+		if(tok.hash() != ENV_HASH_INVALID) {
+			field.push_back(std::pair<std::string, uint32_t>(tok.text(), tok.hash()));
+		}
+	}
+
+	bench_report("environment.lex", lex.size(), begin, nimble_bench_clock::now());
+
+	begin = nimble_bench_clock::now();
+
+	for(round = 0; round < BENCH_ENV_ROUNDS; ++round) {
+
+		for(iter = 0; iter < field.size(); ++iter) {
+
+			if(reference.find(field.at(iter).first) != reference.end()) {
+				result += reference.find(field.at(iter).first)->second.size();
+				++count;
+			}
+		}
+	}
+
+	bench_report("environment.expand.tree", count, begin, nimble_bench_clock::now());
+	count = 0;
+	begin = nimble_bench_clock::now();
+
+	for(round = 0; round < BENCH_ENV_ROUNDS; ++round) {
+
+		for(iter = 0; iter < field.size(); ++iter) {
+
+			if(inst->environment_lookup(field.at(iter).first, ENV_HASH_INVALID, value)) {
+				result += value.size();
+				++count;
+			}
+		}
+	}
+
+	bench_report("environment.expand.hash", count, begin, nimble_bench_clock::now());
+	count = 0;
+	begin = nimble_bench_clock::now();
+
+	for(round = 0; round < BENCH_ENV_ROUNDS; ++round) {
+
+		for(iter = 0; iter < field.size(); ++iter) {
+
+			if(inst->environment_lookup(field.at(iter).first, field.at(iter).second, value)) {
+				result += value.size();
+				++count;
+			}
+		}
+	}
+
+	bench_report("environment.expand.prehash", count, begin, nimble_bench_clock::now());
+
+	if(result != (count * 3 * std::string(BENCH_ENV_VALUE).size())) {
+		bench_failed = true;
+		std::cerr << "environment.expand: mismatched results" << std::endl;
+	}
+
+	inst->uninitialize();
+}
+
+void 
+bench_environment_export(void)
+{
+	char **envp = NULL;
+	size_t iter, result = 0;
+	nimble_environment_map env;
+	nimble_bench_clock::time_point begin;
+
+	for(iter = 0; iter < BENCH_ENV_COUNT; ++iter) {
+		std::stringstream name;
+
+		name << BENCH_ENV_PREFIX << iter;
+		env.insert(nimble_environment_pair(name.str(), BENCH_ENV_VALUE));
+	}
+
+	begin = nimble_bench_clock::now();
+	envp = env.envp();
+	bench_report("environment.export.full", env.size(), begin, nimble_bench_clock::now());
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < BENCH_ENV_COUNT; ++iter) {
+		std::stringstream name, value;
+
+		name << BENCH_ENV_PREFIX << iter;
+		value << BENCH_ENV_VALUE << iter;
+		env.set(name.str(), value.str(), nimble_environment::hash(name.str().c_str(), 
+			name.str().size()));
+		envp = env.envp();
+		result += (envp[iter] != NULL);
+	}
+
+	bench_report("environment.export.incremental", result, begin, 
+		nimble_bench_clock::now());
+}
+
+void 
+bench_environment_rcu_reader(
+	__in nimble_environment_rcu &env,
+	__in const std::vector<std::pair<std::string, uint32_t>> &field,
+	__in size_t seed,
+	__inout std::atomic<size_t> &error,
+	__in size_t reads
+	)
+{
+	std::string value;
+	size_t iter, position;
+
+	try {
+
+		for(iter = 0; iter < reads; ++iter) {
+			position = ((seed + (iter * 7919)) % field.size());
+
+			if(!env.find(field.at(position).first, field.at(position).second, value)
+					|| (value.compare(0, field.at(position).first.size() + 1, 
+					field.at(position).first + CHAR_SPACE))) {
+				++error;
+			}
+		}
+	} catch(nimble_exception &exc) {
+		std::cerr << "environment.rcu: " << exc.to_string(true) << std::endl;
+		++error;
+	}
+}
+
+void 
+bench_environment_rcu_writer(
+	__in nimble_environment_rcu &env,
+	__in const std::vector<std::pair<std::string, uint32_t>> &field,
+	__in size_t seed,
+	__in std::atomic<bool> &active,
+	__inout std::atomic<size_t> &update
+	)
+{
+	size_t iter = 0, position;
+
+	while(active.load()) {
+		std::stringstream value;
+
+		position = ((seed + (iter++ * 104729)) % field.size());
+		value << field.at(position).first << CHAR_SPACE << iter;
+		env.set(field.at(position).first, value.str(), field.at(position).second);
+		++update;
+	}
+}
+
+void 
+bench_environment_rcu(void)
+{
+	nimble_environment_rcu env;
+	size_t iter, reader, writer;
+	std::atomic<bool> active(true);
+	std::vector<std::thread> thread;
+	nimble_bench_clock::time_point begin;
+	std::atomic<size_t> error(0), update(0);
+	std::vector<std::pair<std::string, uint32_t>> field;
+
+	for(iter = 0; iter < BENCH_RCU_COUNT; ++iter) {
+		std::stringstream name;
+
+		name << BENCH_ENV_PREFIX << iter;
+		field.push_back(std::pair<std::string, uint32_t>(name.str(), 
+			nimble_environment::hash(name.str().c_str(), name.str().size())));
+		env.set(name.str(), name.str() + CHAR_SPACE, field.back().second);
+	}
+
+	for(reader = 1; reader <= BENCH_RCU_READERS_MAX; reader *= 2) {
+		std::stringstream name;
+
+		active.store(true);
+		update.store(0);
+
+		for(writer = 0; writer < BENCH_RCU_WRITERS; ++writer) {
+			thread.push_back(std::thread(bench_environment_rcu_writer, std::ref(env), 
+				std::cref(field), writer, std::ref(active), std::ref(update)));
+		}
+
+		begin = nimble_bench_clock::now();
+
+		for(iter = 0; iter < reader; ++iter) {
+			thread.push_back(std::thread(bench_environment_rcu_reader, std::ref(env), 
+				std::cref(field), iter, std::ref(error), BENCH_RCU_READS));
+		}
+
+		for(iter = BENCH_RCU_WRITERS; iter < thread.size(); ++iter) {
+			thread.at(iter).join();
+		}
+
+		name << "environment.rcu.read." << reader;
+		bench_report(name.str(), reader * BENCH_RCU_READS, begin, nimble_bench_clock::now());
+		active.store(false);
+
+		for(iter = 0; iter < BENCH_RCU_WRITERS; ++iter) {
+			thread.at(iter).join();
+		}
+
+		thread.clear();
+		bench_report(name.str() + ".update", update.load(), begin, nimble_bench_clock::now());
+	}
+
+	begin = nimble_bench_clock::now();
+
+	for(reader = 0; reader < BENCH_RCU_CHURN; reader += BENCH_RCU_CHURN_WAVE) {
+
+		for(iter = 0; iter < BENCH_RCU_CHURN_WAVE; ++iter) {
+			thread.push_back(std::thread(bench_environment_rcu_reader, std::ref(env), 
+				std::cref(field), reader + iter, std::ref(error), BENCH_RCU_CHURN_READS));
+		}
+
+		for(iter = 0; iter < thread.size(); ++iter) {
+			thread.at(iter).join();
+		}
+
+		thread.clear();
+	}
+
+	bench_report("environment.rcu.churn", BENCH_RCU_CHURN * BENCH_RCU_CHURN_READS, begin, 
+		nimble_bench_clock::now());
+
+	if(error.load() || (env.size() != BENCH_RCU_COUNT)) {
+		bench_failed = true;
+		std::cerr << "environment.rcu: " << error.load() << " inconsistent reads, " 
+			<< env.size() << "/" << BENCH_RCU_COUNT << " entries" << std::endl;
+	}
+
+	std::cout << "environment.rcu: " << env.generation() << " generations, " 
+		<< env.retired() << " retired" << std::endl;
+}
+
+void 
+bench_executor(void)
+{
+	size_t iter;
+	std::string input;
+	nimble_ptr inst = NULL;
+	nimble_bench_clock::time_point begin;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	for(iter = 0; iter < BENCH_GENERATE_NAMES; ++iter) {
+		std::stringstream name;
+
+		name << BENCH_ENV_PREFIX << iter;
+		inst->environment_set(name.str(), BENCH_ENV_VALUE);
+	}
+
+	input = bench_generate(BENCH_GENERATE_ASSIGN_LINES, true);
+	nimble_executor exe(input);
+	exe.evaluate(inst->environment_share());
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+	exe.evaluate(inst->environment_share());
+	bench_report("executor.assign", BENCH_GENERATE_ASSIGN_LINES, begin, 
+		nimble_bench_clock::now());
+	bench_report_alloc("executor.assign", BENCH_GENERATE_ASSIGN_LINES);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < BENCH_LEXER_ROUNDS; ++iter) {
+		nimble_executor instance(input);
+
+		instance.evaluate(inst->environment_share());
+	}
+
+	bench_report("executor.assign.cold", iter * BENCH_GENERATE_ASSIGN_LINES, begin, 
+		nimble_bench_clock::now());
+	bench_report_alloc("executor.assign.cold", iter * BENCH_GENERATE_ASSIGN_LINES);
+}
+
+template<class FactoryType> void 
+bench_factory_policy(
+	__in const std::string &name,
+	__in FactoryType *fact
+	)
+{
+	size_t iter, live, round;
+	std::vector<nimble_uid> uids;
+	nimble_bench_clock::time_point begin;
+
+	live = fact->size();
+	uids.reserve(BENCH_FACTORY_COUNT);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(round = 0; round < BENCH_FACTORY_ROUNDS; ++round) {
+
+		for(iter = 0; iter < BENCH_FACTORY_COUNT; ++iter) {
+			uids.push_back(fact->generate());
+		}
+
+		for(iter = 0; iter < uids.size(); ++iter) {
+			fact->decrement_reference(uids.at(iter));
+		}
+
+		uids.clear();
+	}
+
+	bench_report(name + ".churn", round * BENCH_FACTORY_COUNT * 2, begin, 
+		nimble_bench_clock::now());
+	bench_report_alloc(name + ".churn", round * BENCH_FACTORY_COUNT * 2);
+
+	if(fact->size() != live) {
+		bench_failed = true;
+		std::cerr << name << ".churn: " << (fact->size() - live) << " objects leaked" 
+			<< std::endl;
+	}
+}
+
+void 
+bench_factory(void)
+{
+	nimble_ptr inst = NULL;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	bench_factory_policy("factory.token", inst->acquire_token());
+	bench_factory_policy("factory.node", inst->acquire_node());
+	bench_factory_policy("factory.command", inst->acquire_command());
+}
+
+void 
+bench_lexer(void)
+{
+	char ch;
+	std::string input;
+	nimble_generator generator(BENCH_GENERATE_SEED);
+	nimble_ptr inst = NULL;
+	size_t count, iter, result = 0;
+	nimble_bench_clock::time_point begin;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	input = generator.generate(BENCH_GENERATE_LINES);
+	nimble_lexer_base base(input);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(count = 0, iter = 0; iter < BENCH_LEXER_ROUNDS; ++iter) {
+		base.reset();
+
+		while(base.has_next_character()) {
+			ch = base.move_next_character();
+			result += (uint8_t) ch;
+			++count;
+		}
+	}
+
+	bench_report("lexer.base.step", count, begin, nimble_bench_clock::now());
+	bench_report_alloc("lexer.base.step", count);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(count = 0, iter = 0; iter < BENCH_LEXER_ROUNDS; ++iter) {
+		nimble_lexer lex(input);
+
+		count += lex.discover();
+	}
+
+	bench_report("lexer.discover", count, begin, nimble_bench_clock::now());
+	bench_report_alloc("lexer.discover", count);
+
+	if(count != (generator.tokens() * BENCH_LEXER_ROUNDS)) {
+		bench_failed = true;
+		std::cerr << "lexer.discover: expecting " << generator.tokens() << " tokens" << std::endl;
+	}
+
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(count = 0, iter = 0; iter < BENCH_LEXER_ROUNDS; ++iter) {
+		nimble_parser parser(input);
+
+		count += parser.discover();
+	}
+
+	bench_report("parse.discover", count, begin, nimble_bench_clock::now());
+	bench_report_alloc("parse.discover", count);
+
+	if(count != (generator.statements() * BENCH_LEXER_ROUNDS)) {
+		bench_failed = true;
+		std::cerr << "parse.discover: expecting " << generator.statements() << " statements" 
+			<< std::endl;
+	}
+
+	if(!result) {
+		bench_failed = true;
+		std::cerr << "lexer.base.step: no characters stepped" << std::endl;
+	}
+}
+
+template<class StoragePolicy, class LockPolicy> void 
+bench_object_policy(
+	__in const std::string &name
+	)
+{
+	size_t iter, round, result = 0;
+	std::vector<nimble_uid> uids;
+	nimble_bench_clock::time_point begin;
+	nimble_object_factory<nimble_token, StoragePolicy, LockPolicy> fact(name);
+
+	fact.initialize();
+
+	for(round = 0; round < 2; ++round) {
+		begin = nimble_bench_clock::now();
+
+		for(iter = 0; iter < BENCH_OBJECT_COUNT; ++iter) {
+			uids.push_back(fact.generate());
+		}
+
+		bench_report(name + (round ? ".reuse" : ".generate"), uids.size(), begin, 
+			nimble_bench_clock::now());
+
+		if(!round) {
+			begin = nimble_bench_clock::now();
+
+			for(iter = 0; iter < (BENCH_OBJECT_COUNT * BENCH_OBJECT_ROUNDS); ++iter) {
+				result += fact.at(uids.at((iter * 7919) % BENCH_OBJECT_COUNT)).column();
+			}
+
+			bench_report(name + ".lookup", iter, begin, nimble_bench_clock::now());
+		}
+
+		begin = nimble_bench_clock::now();
+
+		for(iter = 0; iter < uids.size(); ++iter) {
+			fact.decrement_reference(uids.at(iter));
+		}
+
+		bench_report(name + ".release", uids.size(), begin, nimble_bench_clock::now());
+		uids.clear();
+	}
+
+	if(result || fact.size()) {
+		bench_failed = true;
+		std::cerr << name << ": " << fact.size() << " objects leaked, column sum " 
+			<< result << std::endl;
+	}
+
+	fact.uninitialize();
+}
+
+template<class T> void 
+bench_move_policy(
+	__in const std::string &name,
+	__in std::vector<T> &source
+	)
+{
+	size_t iter;
+	std::vector<T> copy, move;
+	nimble_bench_clock::time_point begin;
+
+	copy.reserve(source.size());
+	move.reserve(source.size());
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < source.size(); ++iter) {
+		copy.push_back(source.at(iter));
+	}
+
+	bench_report(name + ".copy", iter, begin, nimble_bench_clock::now());
+	bench_report_alloc(name + ".copy", iter);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < source.size(); ++iter) {
+		move.push_back(std::move(source.at(iter)));
+	}
+
+	bench_report(name + ".move", iter, begin, nimble_bench_clock::now());
+	bench_report_alloc(name + ".move", iter);
+}
+
+void 
+bench_move(void)
+{
+	size_t iter, live;
+	nimble_ptr inst = NULL;
+	std::vector<nimble_node> node;
+	std::vector<nimble_token> token;
+	std::vector<nimble_command> command;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	live = inst->acquire_uid()->size();
+	token.resize(BENCH_MOVE_COUNT);
+	node.resize(BENCH_MOVE_COUNT);
+	command.resize(BENCH_MOVE_COUNT);
+
+	for(iter = 0; iter < BENCH_MOVE_COUNT; ++iter) {
+		token.at(iter).text() = BENCH_MOVE_TEXT;
+		token.at(iter).path() = BENCH_ENV_VALUE;
+		node.at(iter).children().assign(BENCH_MOVE_CHILDREN, iter);
+		command.at(iter).text() = BENCH_MOVE_TEXT;
+	}
+
+	bench_move_policy("move.token", token);
+	bench_move_policy("move.node", node);
+	bench_move_policy("move.command", command);
+	token.clear();
+	node.clear();
+	command.clear();
+
+	if(inst->acquire_uid()->size() != live) {
+		bench_failed = true;
+		std::cerr << "move: " << (inst->acquire_uid()->size() - live) << " uids leaked" 
+			<< std::endl;
+	}
+}
+
+void 
+bench_node(void)
+{
+	nimble_ptr inst = NULL;
+	nimble_bench_clock::time_point begin;
+	size_t count = 0, example, iter, live;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	bench_report_size("node.size", sizeof(nimble_node));
+
+	for(example = 0; example < BENCH_NODE_EXAMPLE_COUNT; ++example) {
+		live = inst->acquire_node()->size();
+		BENCH_ALLOC_RESET();
+		begin = nimble_bench_clock::now();
+
+		for(iter = 0; iter < BENCH_NODE_ROUNDS; ++iter) {
+			nimble_parser parser(BENCH_NODE_EXAMPLE[example]);
+
+			while(parser.has_next_statement()) {
+				parser.move_next_statement();
+			}
+
+			if(!iter) {
+				count = (inst->acquire_node()->size() - live);
+			}
+		}
+
+		bench_report("node \'" + BENCH_NODE_EXAMPLE[example] + "\'", iter, begin, 
+			nimble_bench_clock::now());
+		bench_report_alloc("node \'" + BENCH_NODE_EXAMPLE[example] + "\'", iter);
+		std::cout << "node \'" << BENCH_NODE_EXAMPLE[example] << "\': " << count << " nodes" 
+			<< std::endl;
+	}
+}
+
+void 
+bench_object(void)
+{
+	nimble_uid_factory_ptr fact = NULL;
+
+	fact = nimble::acquire()->acquire_uid();
+	if(!fact->is_initialized()) {
+		fact->initialize();
+	}
+
+	bench_object_policy<nimble_storage_pool<nimble_token>, nimble_lock_none>(
+		"object.pool.none");
+	bench_object_policy<nimble_storage_pool<nimble_token>, nimble_lock_recursive>(
+		"object.pool.recursive");
+	bench_object_policy<nimble_storage_map<nimble_token>, nimble_lock_none>(
+		"object.map.none");
+	bench_object_policy<nimble_storage_map<nimble_token>, nimble_lock_recursive>(
+		"object.map.recursive");
+}
+
+void 
+bench_parse(void)
+{
+	nimble_ptr inst = NULL;
+	std::string input;
+	size_t iter, result = 0;
+	nimble_bench_clock::time_point begin;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	for(iter = 0; iter < BENCH_PARSE_LINES; ++iter) {
+		input += (iter ? BENCH_PARSE_SEPARATOR BENCH_PARSE_LINE : BENCH_PARSE_LINE);
+	}
+
+	nimble_parser parser(input);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+
+	while(parser.has_next_statement()) {
+		parser.move_next_statement();
+		++result;
+	}
+
+	bench_report("parse.statement", result, begin, nimble_bench_clock::now());
+	bench_report_alloc("parse.statement", result);
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+	parser.reset();
+
+	for(iter = 0; parser.has_next_statement(); ++iter) {
+		result += parser.statement().size();
+		parser.move_next_statement();
+	}
+
+	bench_report("parse.revisit", iter, begin, nimble_bench_clock::now());
+	bench_report_alloc("parse.revisit", iter);
+
+	for(input.clear(), iter = 0; iter < BENCH_PARSE_LINES; ++iter) {
+		input += (iter ? BENCH_PARSE_SEPARATOR BENCH_PARSE_ASSIGN : BENCH_PARSE_ASSIGN);
+	}
+
+	nimble_executor exe(input);
+	exe.evaluate(inst->environment_share());
+	BENCH_ALLOC_RESET();
+	begin = nimble_bench_clock::now();
+	exe.evaluate(inst->environment_share());
+	bench_report("parse.evaluate", BENCH_PARSE_LINES, begin, nimble_bench_clock::now());
+	bench_report_alloc("parse.evaluate", BENCH_PARSE_LINES);
+}
+
+std::string 
+bench_shell_arguments(
+	__in size_t iter
+	)
+{
+	size_t argument;
+	std::stringstream result;
+
+	result << BENCH_SHELL_TRUE;
+
+	for(argument = 0; argument < BENCH_SHELL_ARGUMENTS; ++argument) {
+		result << CHAR_SPACE << "arg" << iter << "_" << argument;
+	}
+
+	return result.str();
+}
+
+std::string 
+bench_shell_assign(
+	__in size_t iter
+	)
+{
+	std::stringstream result;
+
+	result << "$" << BENCH_ENV_PREFIX << (iter % BENCH_GENERATE_NAMES) << " = \"value " 
+		<< iter << "\"";
+
+	return result.str();
+}
+
+std::string 
+bench_shell_environment(
+	__in size_t iter
+	)
+{
+	std::stringstream result;
+
+	result << BENCH_SHELL_TRUE << " $" << BENCH_ENV_PREFIX 
+		<< ((iter * 7919) % BENCH_SHELL_ENV_COUNT);
+
+	return result.str();
+}
+
+void 
+bench_shell_exit(void)
+{
+	struct rusage usage[2];
+
+	if(bench_shell_usage != INVALID_TYPE(int)) {
+		getrusage(RUSAGE_SELF, &usage[0]);
+		getrusage(RUSAGE_CHILDREN, &usage[1]);
+
+		if(write(bench_shell_usage, usage, sizeof(usage)) != sizeof(usage)) {
+			std::cerr << "shell: failed to write usage, err. " << errno << std::endl;
+		}
+
+		close(bench_shell_usage);
+		bench_shell_usage = INVALID_TYPE(int);
+	}
+}
+
+int 
+bench_shell_child(
+	__in int usage
+	)
+{
+	int result = 0;
+	nimble_ptr inst = NULL;
+
+	bench_shell_usage = usage;
+	fcntl(bench_shell_usage, F_SETFD, FD_CLOEXEC);
+	std::atexit(bench_shell_exit);
+
+	inst = nimble::acquire();
+	inst->initialize();
+	result = inst->run(0, NULL, (const char **) environ);
+	inst->uninitialize();
+
+	return result;
+}
+
+std::string 
+bench_shell_external(
+	__in size_t iter
+	)
+{
+	return BENCH_SHELL_TRUE;
+}
+
+std::string 
+bench_shell_nested(
+	__in size_t iter
+	)
+{
+	size_t depth;
+	std::string result = BENCH_SHELL_TRUE;
+
+	for(depth = 0; depth < BENCH_SHELL_DEPTH; ++depth) {
+		result = "( " + result + " )";
+	}
+
+	return result;
+}
+
+bool 
+bench_shell_prompt(
+	__in int fd
+	)
+{
+	ssize_t length;
+	std::string input;
+	bool result = false;
+	char buffer[BENCH_SHELL_READ];
+
+	while(!result) {
+
+		length = read(fd, buffer, BENCH_SHELL_READ);
+		if(length <= 0) {
+			break;
+		}
+
+		input.append(buffer, length);
+		result = (input.find(BENCH_SHELL_PROMPT) != std::string::npos);
+	}
+
+	return result;
+}
+
+double 
+bench_shell_percentile(
+	__in const std::vector<double> &latency,
+	__in double percentile
+	)
+{
+	size_t position;
+
+	position = (size_t) std::ceil(percentile * latency.size());
+
+	return (latency.empty() ? 0.0 : latency.at(position ? (position - 1) : 0));
+}
+
+void 
+bench_shell_workload(
+	__in const std::string &name,
+	__in nimble_bench_shell_cb line,
+	__in_opt size_t environment = 0
+	)
+{
+	pid_t pid;
+	size_t iter;
+	std::string text;
+	struct rusage usage[2];
+	std::vector<double> latency;
+	std::vector<const char *> envp;
+	std::vector<std::string> entry;
+	int input[2], output[2], result[2], status;
+	nimble_bench_clock::time_point begin, end, start;
+
+	for(iter = 0; environ[iter]; ++iter) {
+		envp.push_back(environ[iter]);
+	}
+
+	for(iter = 0; iter < environment; ++iter) {
+		std::stringstream field;
+
+		field << BENCH_ENV_PREFIX << iter << ENV_ASSIGN << BENCH_ENV_VALUE;
+		entry.push_back(field.str());
+	}
+
+	for(iter = 0; iter < entry.size(); ++iter) {
+		envp.push_back(entry.at(iter).c_str());
+	}
+
+	envp.push_back(NULL);
+	memset(usage, 0, sizeof(usage));
+
+	if((pipe(input) == INVALID_TYPE(int)) 
+			|| (pipe(output) == INVALID_TYPE(int))
+			|| (pipe(result) == INVALID_TYPE(int))) {
+		std::cerr << name << ": failed to create pipe, err. " << errno << std::endl;
+		return;
+	}
+
+	text = std::to_string(result[1]);
+	std::cout.flush();
+	std::cerr.flush();
+
+	pid = fork();
+	if(!pid) {
+		dup2(input[0], STDIN_FILENO);
+		dup2(output[1], STDOUT_FILENO);
+		close(input[0]);
+		close(input[1]);
+		close(output[0]);
+		close(output[1]);
+		close(result[0]);
+		execle(BENCH_SHELL_IMAGE, BENCH_SHELL_IMAGE, BENCH_FLAG_SHELL, text.c_str(), NULL, 
+			&envp[0]);
+		_exit(INVALID_TYPE(int));
+	}
+
+	close(input[0]);
+	close(output[1]);
+	close(result[1]);
+
+	if(pid == PID_INVALID) {
+		std::cerr << name << ": failed to fork, err. " << errno << std::endl;
+	} else if(bench_shell_prompt(output[0])) {
+		begin = nimble_bench_clock::now();
+
+		for(iter = 0; iter < BENCH_SHELL_COMMANDS; ++iter) {
+			text = line(iter) + "\n";
+			start = nimble_bench_clock::now();
+
+			if((write(input[1], text.c_str(), text.size()) != (ssize_t) text.size())
+					|| !bench_shell_prompt(output[0])) {
+				std::cerr << name << ": shell stopped after " << iter << " commands" << std::endl;
+				break;
+			}
+
+			latency.push_back(std::chrono::duration<double, std::micro>(
+				nimble_bench_clock::now() - start).count());
+		}
+
+		end = nimble_bench_clock::now();
+		text = std::string(BENCH_SHELL_EXIT) + "\n";
+
+		if(write(input[1], text.c_str(), text.size()) == (ssize_t) text.size()) {
+			while(bench_shell_prompt(output[0]));
+		}
+	}
+
+	close(input[1]);
+	close(output[0]);
+
+	if(pid != PID_INVALID) {
+		waitpid(pid, &status, 0);
+
+		if(read(result[0], usage, sizeof(usage)) != sizeof(usage)) {
+			std::cerr << name << ": shell usage unavailable" << std::endl;
+		}
+	}
+
+	close(result[0]);
+
+	if(!latency.empty()) {
+		nimble_bench_record &record = bench_record_find(name);
+
+		std::sort(latency.begin(), latency.end());
+		bench_report(name, latency.size(), begin, end);
+		record.has_latency = true;
+		record.latency_max = latency.back();
+		record.latency_p50 = bench_shell_percentile(latency, 0.50);
+		record.latency_p90 = bench_shell_percentile(latency, 0.90);
+		record.latency_p99 = bench_shell_percentile(latency, 0.99);
+		record.has_usage = true;
+		record.usage_children = usage[1];
+		record.usage_self = usage[0];
+		std::cout << std::left << std::setw(32) << name << std::right << std::fixed 
+			<< std::setprecision(1) << " p50 " << record.latency_p50 << " us, p90 " 
+			<< record.latency_p90 << " us, p99 " << record.latency_p99 << " us, max " 
+			<< record.latency_max << " us" << std::endl << std::left << std::setw(32) << name 
+			<< std::right << " shell cpu " << std::setprecision(3) 
+			<< (BENCH_USAGE_USEC(record.usage_self.ru_utime) / 1000.0) << " ms user, " 
+			<< (BENCH_USAGE_USEC(record.usage_self.ru_stime) / 1000.0) << " ms sys, " 
+			<< (BENCH_USAGE_USEC(record.usage_self.ru_utime) 
+				/ (double) latency.size()) << " us/cmd user" << std::endl;
+	}
+}
+
+void 
+bench_shell(void)
+{
+	std::signal(SIGPIPE, SIG_IGN);
+	bench_shell_workload("shell.external", bench_shell_external);
+	bench_shell_workload("shell.assign", bench_shell_assign);
+	bench_shell_workload("shell.arguments", bench_shell_arguments);
+	bench_shell_workload("shell.nested", bench_shell_nested);
+	bench_shell_workload("shell.environment", bench_shell_environment, BENCH_SHELL_ENV_COUNT);
+	std::signal(SIGPIPE, SIG_DFL);
+}
+
+void 
+bench_size(void)
+{
+#ifdef NIMBLE_THREADED
+	std::cout << "size: threaded" << std::endl;
+#else
+	std::cout << "size: single-threaded" << std::endl;
+#endif // NIMBLE_THREADED
+	BENCH_SIZE(nimble_lock_policy);
+	BENCH_SIZE(nimble_exception);
+	BENCH_SIZE(nimble_token_meta);
+	BENCH_SIZE(nimble_uid);
+	BENCH_SIZE(nimble_uid_class);
+	BENCH_SIZE(nimble_token);
+	BENCH_SIZE(nimble_node);
+	BENCH_SIZE(nimble_command);
+	BENCH_SIZE(nimble_lexer_base);
+	BENCH_SIZE(nimble_lexer);
+	BENCH_SIZE(nimble_parser);
+	BENCH_SIZE(nimble_executor);
+	BENCH_SIZE(nimble_token_factory);
+	BENCH_SIZE(nimble_node_factory);
+	BENCH_SIZE(nimble_command_factory);
+}
+
+void 
+bench_stats(void)
+{
+	nimble_stats stats;
+	nimble_ptr inst = NULL;
+	size_t iter, lexer, parser, token;
+	nimble_bench_clock::time_point begin;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < BENCH_STATS_OPERATIONS; ++iter) {
+		stats.allocate();
+		stats.release();
+	}
+
+	bench_report("stats.counter", iter * 2, begin, nimble_bench_clock::now());
+
+	if((stats.live() != 0) || (stats.peak() != 1) 
+			|| (stats.created() != BENCH_STATS_OPERATIONS)
+			|| (stats.released() != BENCH_STATS_OPERATIONS)) {
+		bench_failed = true;
+		std::cerr << "stats.counter: " << nimble_stats::as_string("counter", stats) 
+			<< std::endl;
+	}
+
+	lexer = nimble_lexer::token_stats().live();
+	parser = nimble_parser::statement_stats().live();
+	token = inst->acquire_token()->stats().live();
+
+	for(iter = 0; iter < BENCH_NODE_EXAMPLE_COUNT; ++iter) {
+		nimble_parser instance(BENCH_NODE_EXAMPLE[iter]);
+
+		while(instance.has_next_statement()) {
+			instance.move_next_statement();
+		}
+	}
+
+	if((nimble_lexer::token_stats().live() != lexer)
+			|| (nimble_parser::statement_stats().live() != parser)) {
+		bench_failed = true;
+		std::cerr << "stats.lifetime: lexer/parser instances leaked" << std::endl;
+	}
+
+	std::cout << "stats.lifetime: " << (inst->acquire_token()->stats().live() - token) 
+		<< " tokens live after release" << std::endl << inst->stats_as_string() << std::endl;
+}
+
+void 
+bench_trace(void)
+{
+	DIR *dir;
+	size_t batch, iter;
+	nimble_lvl_t level;
+	struct dirent *entry;
+	nimble_bench_clock::duration elapsed;
+	char directory[] = BENCH_TRACE_DIRECTORY;
+	nimble_bench_clock::time_point begin;
+
+	level = nimble_trace::level();
+	nimble_trace::set_level(TRACE_NONE);
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < BENCH_TRACE_OPERATIONS; ++iter) {
+		TRACE_MESSAGE(TRACE_INFORMATION, "iter. %lu", iter);
+	}
+
+	bench_report("trace.disabled", iter, begin, nimble_bench_clock::now());
+
+	if(!mkdtemp(directory)) {
+		bench_failed = true;
+		std::cerr << "trace.enabled: failed to create " << directory << std::endl;
+	} else {
+		nimble_trace::start(TRACE_INFORMATION, directory, BENCH_TRACE_OUTPUT);
+		elapsed = nimble_bench_clock::duration::zero();
+
+		for(iter = 0; iter < BENCH_TRACE_ENABLED_OPERATIONS;) {
+			begin = nimble_bench_clock::now();
+
+			for(batch = 0; batch < BENCH_TRACE_ENABLED_BATCH; ++batch, ++iter) {
+				TRACE_MESSAGE(TRACE_INFORMATION, "iter. %lu", iter);
+			}
+
+			elapsed += (nimble_bench_clock::now() - begin);
+			TRACE_FLUSH();
+		}
+
+		begin = nimble_bench_clock::time_point();
+		bench_report("trace.enabled", iter, begin, begin + elapsed);
+		nimble_trace::stop();
+
+		dir = opendir(directory);
+		if(dir) {
+
+			while((entry = readdir(dir))) {
+
+				if(entry->d_name[0] != '.') {
+					unlink((std::string(directory) + "/" + entry->d_name).c_str());
+				}
+			}
+
+			closedir(dir);
+		}
+
+		rmdir(directory);
+	}
+
+	nimble_trace::set_level(level);
+}
+
+void 
+bench_uid(void)
+{
+	nimble_uid stale;
+	nimble_uid_factory_ptr fact = NULL;
+	size_t iter, live, position, result = 0;
+	nimble_bench_clock::time_point begin;
+	std::vector<nimble_uid> window(BENCH_UID_WINDOW);
+
+	fact = nimble_uid_factory::acquire();
+	if(!fact->is_initialized()) {
+		fact->initialize();
+	}
+
+	live = fact->size();
+
+	for(iter = 0; iter < BENCH_UID_WINDOW; ++iter) {
+		fact->generate(window.at(iter));
+	}
+
+	begin = nimble_bench_clock::now();
+
+	for(iter = 0; iter < (BENCH_UID_OPERATIONS / 4); ++iter) {
+		position = ((iter * 7919) % BENCH_UID_WINDOW);
+		fact->increment_reference(window.at(position));
+		fact->decrement_reference(window.at(position));
+		fact->decrement_reference(window.at(position));
+		result += fact->generate(window.at(position));
+	}
+
+	bench_report("uid.churn", iter * 4, begin, nimble_bench_clock::now());
+	stale = window.front();
+	fact->decrement_reference(window.front());
+	fact->generate(window.front());
+
+	if((result != (BENCH_UID_OPERATIONS / 4))
+			|| (fact->size() != (live + BENCH_UID_WINDOW))
+			|| fact->contains(stale)) {
+		bench_failed = true;
+		std::cerr << "uid.churn: " << (fact->size() - live) << "/" << BENCH_UID_WINDOW 
+			<< " live, stale " << (fact->contains(stale) ? "accepted" : "rejected") 
+			<< std::endl;
+	}
+
+	std::cout << "uid.churn: " << fact->to_string() << std::endl;
+
+	for(iter = 0; iter < BENCH_UID_WINDOW; ++iter) {
+		fact->decrement_reference(window.at(iter));
+	}
+}
+
+static const std::pair<std::string, nimble_bench_cb> BENCH[] = {
+	std::pair<std::string, nimble_bench_cb>("environment", bench_environment_expand),
+	std::pair<std::string, nimble_bench_cb>("environment_export", bench_environment_export),
+	std::pair<std::string, nimble_bench_cb>("environment_rcu", bench_environment_rcu),
+	std::pair<std::string, nimble_bench_cb>("executor", bench_executor),
+	std::pair<std::string, nimble_bench_cb>("factory", bench_factory),
+	std::pair<std::string, nimble_bench_cb>("lexer", bench_lexer),
+	std::pair<std::string, nimble_bench_cb>("move", bench_move),
+	std::pair<std::string, nimble_bench_cb>("node", bench_node),
+	std::pair<std::string, nimble_bench_cb>("object", bench_object),
+	std::pair<std::string, nimble_bench_cb>("parse", bench_parse),
+	std::pair<std::string, nimble_bench_cb>("shell", bench_shell),
+	std::pair<std::string, nimble_bench_cb>("size", bench_size),
+	std::pair<std::string, nimble_bench_cb>("stats", bench_stats),
+	std::pair<std::string, nimble_bench_cb>("trace", bench_trace),
+	std::pair<std::string, nimble_bench_cb>("uid", bench_uid),
+	};
+
+#define BENCH_COUNT (sizeof(BENCH) / sizeof(BENCH[0]))
+
+int 
+main(
+	__in int argc,
+	__in const char **argv
+	)
+{
+	size_t bench;
+	int first = 1, iter, result = 0;
+
+	bench_stdout = std::cout.rdbuf();
+
+	if((argc > first) && (std::string(argv[first]) == BENCH_FLAG_JSON)) {
+		bench_json = true;
+		std::cout.rdbuf(std::cerr.rdbuf());
+		++first;
+	}
+
+	try {
+
+		if((argc > (first + 1)) && (std::string(argv[first]) == BENCH_FLAG_SHELL)) {
+			result = bench_shell_child(std::atoi(argv[first + 1]));
+		} else {
+
+			for(bench = 0; bench < BENCH_COUNT; ++bench) {
+
+				if(argc > first) {
+
+					for(iter = first; iter < argc; ++iter) {
+
+						if(BENCH[bench].first == argv[iter]) {
+							break;
+						}
+					}
+
+					if(iter == argc) {
+						continue;
+					}
+				}
+
+				BENCH[bench].second();
+			}
+		}
+	} catch(nimble_exception &exc) {
+		std::cerr << exc.to_string(true) << std::endl;
+		result = INVALID_TYPE(int);
+	} catch(std::exception &exc) {
+		std::cerr << exc.what() << std::endl;
+		result = INVALID_TYPE(int);
+	}
+
+	if(!result && bench_failed) {
+		result = INVALID_TYPE(int);
+	}
+
+	if(bench_json) {
+		std::cout.rdbuf(bench_stdout);
+		std::cout << bench_record_as_json() << std::endl;
+	}
+
+	return result;
+}
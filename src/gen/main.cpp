@@ -0,0 +1,213 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../lib/include/nimble.h"
+
+#define GEN_FLAG_BYTES "-b"
+#define GEN_FLAG_DEPTH "-d"
+#define GEN_FLAG_MIX "-m"
+#define GEN_FLAG_OUTPUT "-o"
+#define GEN_FLAG_SEED "-s"
+#define GEN_FLAG_STATEMENTS "-n"
+#define GEN_FLAG_VERIFY "-v"
+#define GEN_FLAG_WORDS "-w"
+#define GEN_MIX_ASSIGN '='
+#define GEN_MIX_DELIMITER ','
+
+static const std::string GEN_UNIT_STR = "kmg";
+
+size_t 
+gen_parse_size(
+	__in const std::string &text
+	)
+{
+	char *end = NULL;
+	size_t position, result;
+
+	result = strtoull(text.c_str(), &end, 0);
+	if(end && *end) {
+
+		position = GEN_UNIT_STR.find(tolower(*end));
+		if((position == std::string::npos) || *(end + 1)) {
+			throw std::runtime_error("invalid size: " + text);
+		}
+
+		result <<= (10 * (position + 1));
+	}
+
+	return result;
+}
+
+void 
+gen_parse_mix(
+	__inout nimble_generator &generator,
+	__in const std::string &text
+	)
+{
+	uint8_t type;
+	size_t begin = 0, end, position;
+	std::string entry;
+
+	while(begin < text.size()) {
+
+		end = text.find(GEN_MIX_DELIMITER, begin);
+		if(end == std::string::npos) {
+			end = text.size();
+		}
+
+		entry = text.substr(begin, end - begin);
+		position = entry.find(GEN_MIX_ASSIGN);
+		if(position == std::string::npos) {
+			throw std::runtime_error("invalid mix: " + entry);
+		}
+
+		for(type = 0; type <= GEN_MIX_MAX; ++type) {
+
+			if(nimble_generator::mix_as_string(type) == entry.substr(0, position)) {
+				break;
+			}
+		}
+
+		generator.mix(type) = (uint8_t) std::min(gen_parse_size(entry.substr(position + 1)), 
+			(size_t) UINT8_MAX);
+		begin = (end + 1);
+	}
+}
+
+int 
+gen_verify(
+	__in nimble_generator &generator,
+	__in const std::string &input
+	)
+{
+	int result = 0;
+	nimble_ptr inst = NULL;
+	size_t statements, tokens;
+
+	inst = nimble::acquire();
+	if(!inst->is_initialized()) {
+		inst->initialize();
+	}
+
+	nimble_lexer lex(input);
+	tokens = lex.discover();
+	nimble_parser parser(input);
+	statements = parser.discover();
+
+	if((tokens != generator.tokens()) || (statements != generator.statements())) {
+		std::cerr << "Mismatch: tokens " << tokens << "/" << generator.tokens() 
+			<< ", statements " << statements << "/" << generator.statements() << std::endl;
+		result = INVALID_TYPE(int);
+	}
+
+	inst->uninitialize();
+
+	return result;
+}
+
+int 
+main(
+	__in int argc,
+	__in const char **argv
+	)
+{
+	std::string flag, path;
+	std::stringstream buffer;
+	bool verify = false;
+	int iter, result = 0;
+	uint64_t seed = GEN_SEED_DEFAULT;
+	std::vector<std::string> mix;
+	size_t bytes = 0, depth = GEN_DEPTH_DEFAULT, statements = 0, words = GEN_WORDS_DEFAULT;
+
+	try {
+
+		for(iter = 1; iter < argc; ++iter) {
+			flag = argv[iter];
+
+			if(flag == GEN_FLAG_VERIFY) {
+				verify = true;
+			} else if(iter == (argc - 1)) {
+				result = INVALID_TYPE(int);
+				break;
+			} else if(flag == GEN_FLAG_BYTES) {
+				bytes = gen_parse_size(argv[++iter]);
+			} else if(flag == GEN_FLAG_DEPTH) {
+				depth = gen_parse_size(argv[++iter]);
+			} else if(flag == GEN_FLAG_MIX) {
+				mix.push_back(argv[++iter]);
+			} else if(flag == GEN_FLAG_OUTPUT) {
+				path = argv[++iter];
+			} else if(flag == GEN_FLAG_SEED) {
+				seed = gen_parse_size(argv[++iter]);
+			} else if(flag == GEN_FLAG_STATEMENTS) {
+				statements = gen_parse_size(argv[++iter]);
+			} else if(flag == GEN_FLAG_WORDS) {
+				words = gen_parse_size(argv[++iter]);
+			} else {
+				result = INVALID_TYPE(int);
+				break;
+			}
+		}
+
+		if(result || (!bytes && !statements)) {
+			std::cerr << "Usage: " << argv[0] << " [" << GEN_FLAG_SEED << " seed] [" 
+				<< GEN_FLAG_DEPTH << " depth] [" << GEN_FLAG_WORDS << " words] [" 
+				<< GEN_FLAG_MIX << " name=percent,...] [" << GEN_FLAG_OUTPUT << " path] [" 
+				<< GEN_FLAG_VERIFY << "] <" << GEN_FLAG_BYTES << " bytes[k|m|g]> | <" 
+				<< GEN_FLAG_STATEMENTS << " statements>" << std::endl;
+			return INVALID_TYPE(int);
+		}
+
+		nimble_generator generator(seed, depth, words);
+
+		for(iter = 0; iter < (int) mix.size(); ++iter) {
+			gen_parse_mix(generator, mix.at(iter));
+		}
+
+		std::ofstream file;
+		if(!path.empty()) {
+
+			file.open(path.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+			if(!file) {
+				std::cerr << path << ": cannot open" << std::endl;
+				return INVALID_TYPE(int);
+			}
+		}
+
+		std::ostream &stream = (path.empty() ? std::cout : file);
+		if(verify) {
+			generator.generate(buffer, bytes, statements);
+			stream << buffer.str();
+			result = gen_verify(generator, buffer.str());
+		} else {
+			generator.generate(stream, bytes, statements);
+		}
+
+		stream.flush();
+		std::cerr << generator.to_string(true) << std::endl;
+	} catch(nimble_exception &exc) {
+		std::cerr << exc.to_string(true) << std::endl;
+		result = INVALID_TYPE(int);
+	} catch(std::exception &exc) {
+		std::cerr << exc.what() << std::endl;
+		result = INVALID_TYPE(int);
+	}
+
+	return result;
+}
@@ -23,7 +23,7 @@
 #define NDEBUG
 
 #ifndef TLEVEL
-#define TLEVEL TRACE_ERROR
+#define TLEVEL TRACE_INFORMATION
 #endif // TLEVEL
 
 #ifndef TLOGOUT
@@ -37,11 +37,14 @@
 #endif // NIMBLE
 
 #include "nimble_defines.h"
+#include "nimble_lock.h"
 #include "nimble_color.h"
 #include "nimble_trace.h"
+#include "nimble_probe.h"
 #include "nimble_language.h"
 #include "nimble_exception.h"
 #include "nimble_environment.h"
+#include "nimble_stats.h"
 
 using namespace NIMBLE;
 
@@ -50,6 +53,8 @@ using namespace NIMBLE;
 #endif // COMPONENT
 
 #include "nimble_uid.h"
+#include "nimble_object.h"
+#include "nimble_vector.h"
 #include "nimble_command.h"
 #include "nimble_token.h"
 #include "nimble_node.h"
@@ -63,6 +68,7 @@ using namespace NIMBLE::COMPONENT;
 #include "nimble_lexer.h"
 #include "nimble_parser.h"
 #include "nimble_executor.h"
+#include "nimble_generator.h"
 
 using namespace NIMBLE::LANGUAGE;
 
@@ -97,15 +103,36 @@ namespace NIMBLE {
 				__in const std::string &field
 				);
 
+			char **environment_export(void);
+
 			nimble_environment_map::iterator environment_find(
 				__in const std::string &field
 				);
 
 			nimble_environment_map_ptr environment_instance(void);
 
+			bool environment_lookup(
+				__in const std::string &field,
+				__in uint32_t hash,
+				__out std::string &value
+				);
+
+			void environment_remove(
+				__in const std::string &field
+				);
+
+			size_t environment_scope_depth(void);
+
+			void environment_scope_pop(void);
+
+			void environment_scope_push(void);
+
+			void *environment_share(void);
+
 			void environment_set(
 				__in const std::string &field,
-				__in const std::string &value
+				__in const std::string &value,
+				__in_opt uint32_t hash = ENV_HASH_INVALID
 				);
 
 			void initialize(void);
@@ -120,6 +147,12 @@ namespace NIMBLE {
 				__in const char **environment
 				);
 
+			std::string stats_as_string(
+				__in_opt bool json = false
+				);
+
+			void stats_dump(void);
+
 			std::string to_string(
 				__in_opt bool verbose = false
 				);
@@ -162,6 +195,10 @@ namespace NIMBLE {
 				__in int sig
 				);
 
+			static void _signal_trace(
+				__in int sig
+				);
+
 			void display_prompt(
 				__in std::string &home,
 				__in std::string &host,
@@ -180,6 +217,10 @@ namespace NIMBLE {
 
 			nimble_environment_map m_environment_map;
 
+			nimble_environment_scope m_environment_scope;
+
+			void *m_environment_share;
+
 			nimble_command_factory_ptr m_factory_command;
 
 			nimble_node_factory_ptr m_factory_node;
@@ -196,7 +237,7 @@ namespace NIMBLE {
 
 		private:
 
-			std::recursive_mutex m_lock;
+			nimble_lock_policy m_lock;
 
 	} nimble, *nimble_ptr;
 }
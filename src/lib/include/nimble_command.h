@@ -20,19 +20,56 @@
 #ifndef NIMBLE_COMMAND_H_
 #define NIMBLE_COMMAND_H_
 
+#include <fstream>
 #include <signal.h>
+#include <sys/resource.h>
 #include <unistd.h>
+#include <vector>
 
 namespace NIMBLE {
 
 	namespace COMPONENT {
 
+		#define FD_INVALID INVALID_TYPE(int)
+		#define JOB_INVALID 0
 		#define PID_INVALID INVALID_TYPE(pid_t)
+		#define TIME_FLAG_LOG 0x1
+		#define TIME_FLAG_REPORT 0x2
+
+		enum {
+			TIME_FORMAT_TEXT = 0,
+			TIME_FORMAT_CSV,
+			TIME_FORMAT_JSON,
+		};
+
+		#define TIME_FORMAT_MAX TIME_FORMAT_JSON
+
+		enum {
+			TIME_PHASE_LEX = 0,
+			TIME_PHASE_PARSE,
+			TIME_PHASE_EVALUATE,
+			TIME_PHASE_FORK,
+			TIME_PHASE_EXEC,
+			TIME_PHASE_WAIT,
+			TIME_PHASE_TOTAL,
+		};
+
+		#define TIME_PHASE_MAX TIME_PHASE_TOTAL
+
+		typedef struct {
+			uint64_t begin;
+			uint8_t flag;
+			uint64_t phase[TIME_PHASE_MAX + 1];
+			struct rusage usage;
+		} nimble_command_time;
 
 		typedef void (*_nimble_cmd_fact_cb)(
 			__in const nimble_uid &
 			);
 
+		struct _nimble_cmd_par_ctx;
+		typedef _nimble_cmd_par_ctx nimble_cmd_par_ctx, *nimble_cmd_par_ctx_ptr;
+
 		typedef class _nimble_command :
 				public nimble_uid_class {
 
@@ -44,54 +81,108 @@ namespace NIMBLE {
 					__in const _nimble_command &other
 					);
 
+				_nimble_command(
+					__in _nimble_command &&other
+					);
+
 				virtual ~_nimble_command(void);
 
 				_nimble_command &operator=(
 					__in const _nimble_command &other
 					);
 
+				_nimble_command &operator=(
+					__in _nimble_command &&other
+					);
+
 				static std::string as_string(
 					__in const _nimble_command &command,
 					__in_opt bool verbose = false
 					);
 
+				bool foreground(void);
+
 				bool is_active(void);
 
+				bool is_background(void);
+
+				bool is_stopped(void);
+
+				pid_t pid(void);
+
 				int result(void);
 
+				void resume(void);
+
 				void run(
 					__in const std::string &command,
 					__in _nimble_cmd_fact_cb complete,
-					__out bool &update
+					__out bool &update,
+					__in_opt bool background = false,
+					__in_opt int output = FD_INVALID,
+					__in_opt uint8_t time = 0
+					);
+
+				bool status(
+					__in int status,
+					__in_opt const struct rusage *usage = NULL
 					);
 
 				void stop(
 					__in_opt int sig = SIGTERM
 					);
 
+				std::string &text(void);
+
+				nimble_command_time &time(void);
+
+				std::string time_as_string(
+					__in_opt uint8_t format = TIME_FORMAT_TEXT
+					);
+
+				static std::string time_header(void);
+
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					);
 
+				bool wait(void);
+
 			protected:
 
+				static void _terminal_set(
+					__in pid_t group
+					);
+
+				void time_complete(void);
+
 				bool m_active;
 
+				bool m_background;
+
 				_nimble_cmd_fact_cb m_complete;
 
 				nimble_environment_map_ptr m_par_environment;
 
 				pid_t m_pid;
 
+				uint64_t m_probe_begin;
+
 				int m_result;
 
-			private:
+				char *m_share;
+
+				bool m_stopped;
+
+				std::string m_text;
 
-				std::recursive_mutex m_lock;
+				nimble_command_time m_time;
 
 		} nimble_command, *nimble_command_ptr;
 
-		typedef class _nimble_command_factory {
+		typedef class _nimble_command_factory :
+				public nimble_object_factory<nimble_command, nimble_storage_pool<nimble_command>, 
+					nimble_lock_policy> {
 
 			public:
 
@@ -99,17 +190,17 @@ namespace NIMBLE {
 
 				static _nimble_command_factory *acquire(void);
 
-				bool contains(
-					__in const nimble_uid &uid
-					);
-
 				nimble_uid generate(void);
 
 				void initialize(void);
 
 				static bool is_allocated(void);
 
-				bool is_initialized(void);
+				std::string job_as_string(
+					__in size_t job
+					);
+
+				size_t poll(void);
 
 				void run(
 					__in const nimble_uid &uid,
@@ -117,16 +208,10 @@ namespace NIMBLE {
 					__out bool &update
 					);
 
-				size_t size(void);
-
 				void stop_last(
 					__in_opt int sig = SIGTERM
 					);
 
-				std::string to_string(
-					__in_opt bool verbose = false
-					);
-
 				void uninitialize(void);
 
 			protected:
@@ -147,23 +232,57 @@ namespace NIMBLE {
 					__in const nimble_uid &uid
 					);
 
-				std::map<nimble_uid, std::pair<nimble_command, 
-						_nimble_cmd_fact_cb>>::iterator find(
-					__in const nimble_uid &uid
+				static std::string _result_as_string(
+					__in int result
+					);
+
+				static void _run_parallel_worker(
+					__in nimble_cmd_par_ctx_ptr context,
+					__in size_t worker
+					);
+
+				std::map<size_t, std::pair<nimble_uid, pid_t>>::iterator find_job(
+					__in const std::string &argument
 					);
 
-				std::map<nimble_uid, std::pair<nimble_command, 
-					_nimble_cmd_fact_cb>> m_map;
+				void job_remove(
+					__in size_t job
+					);
+
+				bool run_background(
+					__inout std::string &command
+					);
+
+				bool run_builtin(
+					__in const nimble_uid &uid,
+					__in const std::string &command
+					);
+
+				void run_parallel(
+					__in const std::vector<std::string> &commands,
+					__in size_t workers,
+					__in_opt bool verbose = false
+					);
+
+				void time_report(
+					__in nimble_command &command
+					);
+
+				std::map<size_t, std::pair<nimble_uid, pid_t>> m_job;
+
+				std::map<pid_t, size_t> m_job_pid;
+
+				int m_job_poll;
 
-				bool m_initialized;
+				int m_job_signal;
 
 				nimble_uid m_last;
 
 				static _nimble_command_factory *m_instance;
 
-			private:
+				uint8_t m_time_format;
 
-				std::recursive_mutex m_lock;
+				std::ofstream m_time_log;
 
 		} nimble_command_factory, *nimble_command_factory_ptr;
 	}
@@ -36,9 +36,15 @@ namespace NIMBLE {
 			NIMBLE_COMMAND_EXCEPTION_ACTIVE = 0,
 			NIMBLE_COMMAND_EXCEPTION_ALLOCATED,
 			NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SHARE,
+			NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL,
 			NIMBLE_COMMAND_EXCEPTION_INITIALIZED,
+			NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT,
+			NIMBLE_COMMAND_EXCEPTION_INVALID_BACKGROUND,
 			NIMBLE_COMMAND_EXCEPTION_INVALID_CALLBACK,
+			NIMBLE_COMMAND_EXCEPTION_INVALID_JOB,
+			NIMBLE_COMMAND_EXCEPTION_INVALID_LEVEL,
 			NIMBLE_COMMAND_EXCEPTION_INVALID_PID,
+			NIMBLE_COMMAND_EXCEPTION_INVALID_PROFILE,
 			NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE,
 			NIMBLE_COMMAND_EXCEPTION_NOT_FOUND,
 			NIMBLE_COMMAND_EXCEPTION_PID_KILL,
@@ -53,9 +59,15 @@ namespace NIMBLE {
 			"Command is active",
 			"Failed to allocate command component",
 			"Failed to allocate command share",
+			"Failed to allocate command signal handler",
 			"Command component is initialized",
+			"Command received invalid argument",
+			"Command cannot assign in background",
 			"Command received invalid callback",
+			"Job does not exist",
+			"Trace level exceeds compiled level",
 			"Command failed to create child process",
+			"Trace profiling is not compiled in",
 			"Command is not active",
 			"Command does not exist",
 			"Command failed to kill child process",
@@ -61,12 +61,16 @@ namespace NIMBLE {
 
 	#define REF_PARAM(_PARAM_) (void) _PARAM_
 
-	#define _SERIALIZE_CALL(_TYPE_, _MUTEX_) /*\
-		std::lock_guard<_TYPE_> __LOCK ## _MUTEX_(_MUTEX_)*/
+	#ifdef NIMBLE_THREADED
+	#define _SERIALIZE_CALL(_MUTEX_) \
+		std::lock_guard<decltype(_MUTEX_)> __LOCK ## _MUTEX_(_MUTEX_)
+	#else
+	#define _SERIALIZE_CALL(_MUTEX_)
+	#endif // NIMBLE_THREADED
 	#define SERIALIZE_CALL(_MUTEX_) \
-		_SERIALIZE_CALL(std::mutex, _MUTEX_)
+		_SERIALIZE_CALL(_MUTEX_)
 	#define SERIALIZE_CALL_RECUR(_MUTEX_) \
-		_SERIALIZE_CALL(std::recursive_mutex, _MUTEX_)
+		_SERIALIZE_CALL(_MUTEX_)
 
 	#define VAL_AS_HEX(_TYPE_, _VAL_) \
 		std::setw(sizeof(_TYPE_) * 2) << std::setfill('0') << std::hex \
@@ -20,14 +20,291 @@
 #ifndef NIMBLE_ENVIRONMENT_H_
 #define NIMBLE_ENVIRONMENT_H_
 
+#include <atomic>
+#include <vector>
+
 namespace NIMBLE {
 
+	enum {
+		ENV_ACTION_SET = 0,
+		ENV_ACTION_REMOVE,
+	};
+
+	#define ENV_ACTION_MAX ENV_ACTION_REMOVE
+	#define ENV_ASSIGN '='
+	#define ENV_ENTRY_INVALID INVALID_TYPE(uint16_t)
+	#define ENV_ENTRY_MAX (UINT16_MAX - 1)
 	#define ENV_FLAG_EXIT 0x1
-	#define ENV_FLAG_MAX ENV_FLAG_EXIT
-	#define ENV_MEM_LEN 1024
+	#define ENV_FLAG_TIME 0x2
+	#define ENV_FLAG_MAX ENV_FLAG_TIME
+	#define ENV_HASH_INVALID 0
+	#define ENV_MEM_CAP 0x10000000
+	#define ENV_MEM_LEN 0x1000
+	#define ENV_MAP_LEN 0x40
+	#define ENV_RCU_LINE 0x40
+	#define ENV_RCU_READERS 0x100
+
+	enum {
+		ENV_TIME_LEX = 0,
+		ENV_TIME_PARSE,
+		ENV_TIME_EVALUATE,
+		ENV_TIME_EXEC,
+	};
+
+	#define ENV_TIME_MAX ENV_TIME_EXEC
+
+	typedef std::pair<std::string, std::string> nimble_environment_pair;
+
+	typedef class _nimble_environment_map {
+
+		public:
+
+			typedef std::vector<nimble_environment_pair>::iterator iterator;
+
+			typedef std::vector<nimble_environment_pair>::const_iterator const_iterator;
+
+			_nimble_environment_map(void);
+
+			_nimble_environment_map(
+				__in const _nimble_environment_map &other
+				);
+
+			~_nimble_environment_map(void);
+
+			_nimble_environment_map &operator=(
+				__in const _nimble_environment_map &other
+				);
+
+			iterator begin(void);
+
+			const_iterator begin(void) const;
+
+			void clear(void);
+
+			bool empty(void) const;
+
+			iterator end(void);
+
+			const_iterator end(void) const;
+
+			char **envp(void);
+
+			size_t erase(
+				__in const std::string &field
+				);
+
+			iterator find(
+				__in const std::string &field
+				);
+
+			iterator find(
+				__in const std::string &field,
+				__in uint32_t hash
+				);
+
+			const_iterator find(
+				__in const std::string &field
+				) const;
+
+			const_iterator find(
+				__in const std::string &field,
+				__in uint32_t hash
+				) const;
+
+			std::pair<iterator, bool> insert(
+				__in const nimble_environment_pair &entry
+				);
+
+			std::pair<iterator, bool> insert(
+				__in const nimble_environment_pair &entry,
+				__in uint32_t hash
+				);
+
+			std::pair<iterator, bool> set(
+				__in const std::string &field,
+				__in const std::string &value,
+				__in uint32_t hash
+				);
+
+			size_t size(void) const;
+
+			size_t version(void) const;
+
+		protected:
+
+			typedef struct {
+				uint32_t hash;
+				uint32_t position;
+			} nimble_environment_map_bucket;
+
+			uint32_t lookup(
+				__in const std::string &field,
+				__in uint32_t hash
+				) const;
+
+			void rehash(
+				__in uint32_t count
+				);
+
+			std::vector<nimble_environment_map_bucket> m_bucket;
+
+			std::vector<uint32_t> m_dirty;
+
+			std::vector<nimble_environment_pair> m_entry;
+
+			std::vector<char *> m_envp;
+
+			std::vector<std::string> m_export;
+
+			const std::string *m_export_base;
+
+			size_t m_version;
+
+	} nimble_environment_map, *nimble_environment_map_ptr;
+
+	typedef class _nimble_environment_scope {
+
+		public:
+
+			_nimble_environment_scope(
+				__in nimble_environment_map_ptr base
+				);
+
+			~_nimble_environment_scope(void);
+
+			void clear(void);
+
+			size_t depth(void);
+
+			char **envp(void);
+
+			bool find(
+				__in const std::string &field,
+				__in uint32_t hash,
+				__out std::string &value
+				);
+
+			void pop(void);
+
+			void push(void);
+
+			bool remove(
+				__in const std::string &field,
+				__in uint32_t hash
+				);
+
+			void set(
+				__in const std::string &field,
+				__in const std::string &value,
+				__in uint32_t hash
+				);
+
+		protected:
+
+			typedef struct {
+				nimble_environment_map entry;
+				nimble_environment_map removed;
+			} nimble_environment_layer;
+
+			_nimble_environment_scope(
+				__in const _nimble_environment_scope &other
+				);
+
+			_nimble_environment_scope &operator=(
+				__in const _nimble_environment_scope &other
+				);
+
+			bool shadowed(
+				__in const std::string &field,
+				__in uint32_t hash,
+				__in size_t layer
+				);
+
+			nimble_environment_map_ptr m_base;
+
+			size_t m_depth;
+
+			bool m_dirty;
+
+			std::vector<char *> m_envp;
+
+			std::vector<nimble_environment_layer> m_layer;
+
+			size_t m_version;
+
+	} nimble_environment_scope, *nimble_environment_scope_ptr;
+
+	typedef class _nimble_environment_rcu {
+
+		public:
+
+			_nimble_environment_rcu(void);
+
+			~_nimble_environment_rcu(void);
+
+			bool find(
+				__in const std::string &field,
+				__in uint32_t hash,
+				__out std::string &value
+				);
+
+			uint64_t generation(void);
+
+			void publish(
+				__in const nimble_environment_map &map
+				);
+
+			size_t remove(
+				__in const std::string &field
+				);
+
+			size_t retired(void);
+
+			void set(
+				__in const std::string &field,
+				__in const std::string &value,
+				__in uint32_t hash
+				);
+
+			size_t size(void);
+
+		protected:
+
+			typedef struct alignas(ENV_RCU_LINE) {
+				std::atomic<uint64_t> epoch;
+			} nimble_environment_rcu_reader;
+
+			_nimble_environment_rcu(
+				__in const _nimble_environment_rcu &other
+				);
+
+			_nimble_environment_rcu &operator=(
+				__in const _nimble_environment_rcu &other
+				);
+
+			static size_t _reader(void);
+
+			void reclaim(void);
+
+			void swap(
+				__in nimble_environment_map_ptr map
+				);
+
+			std::atomic<nimble_environment_map_ptr> m_current;
+
+			std::atomic<uint64_t> m_epoch;
+
+			nimble_environment_rcu_reader m_reader[ENV_RCU_READERS];
+
+			static std::atomic<size_t> m_reader_count;
+
+			std::vector<std::pair<uint64_t, nimble_environment_map_ptr>> m_retired;
+
+		private:
 
-	typedef std::map<std::string, std::string> nimble_environment_map, 
-		*nimble_environment_map_ptr;
+			std::mutex m_lock;
+
+	} nimble_environment_rcu, *nimble_environment_rcu_ptr;
 
 	typedef class _nimble_environment {
 
@@ -39,6 +316,11 @@ namespace NIMBLE {
 				__in const std::string &value
 				);
 
+			static void *allocate(
+				__in_opt uint16_t slots = ENV_ENTRY_MAX,
+				__in_opt uint32_t capacity = ENV_MEM_CAP
+				);
+
 			static std::string as_string(
 				__in void *context,
 				__in_opt bool verbose = false
@@ -51,6 +333,15 @@ namespace NIMBLE {
 				__out std::string &value
 				);
 
+			static uint8_t at(
+				__in void *context,
+				__in uint16_t position,
+				__out const char *&field,
+				__out uint32_t &field_length,
+				__out const char *&value,
+				__out uint32_t &value_length
+				);
+
 			static uint16_t count(
 				__in void *context
 				);
@@ -65,6 +356,20 @@ namespace NIMBLE {
 				__in uint8_t flag
 				);
 
+			static uint16_t find(
+				__in void *context,
+				__in const std::string &field
+				);
+
+			static uint32_t generation(
+				__in void *context
+				);
+
+			static uint32_t hash(
+				__in const char *data,
+				__in size_t length
+				);
+
 			static void initialize(
 				__inout void *context,
 				__in size_t size
@@ -75,12 +380,63 @@ namespace NIMBLE {
 				__in uint8_t flag
 				);
 
+			static void release(
+				__in void *context
+				);
+
+			static void remove(
+				__in void *context,
+				__in const std::string &field
+				);
+
+			static uint32_t reset(
+				__in void *context
+				);
+
 			static uint32_t size(
 				__in void *context
 				);
 
+			static uint64_t timing(
+				__in void *context,
+				__in uint8_t phase
+				);
+
+			static void timing_set(
+				__in void *context,
+				__in uint8_t phase,
+				__in uint64_t value
+				);
+
 		protected:
 
+			static uint32_t append(
+				__in void *context,
+				__in const char *data,
+				__in uint32_t length
+				);
+
+			static void grow(
+				__in void *context,
+				__in uint32_t size
+				);
+
+			static uint16_t insert(
+				__in void *context,
+				__in const std::string &field,
+				__in uint32_t hash,
+				__in uint32_t bucket,
+				__in uint8_t action
+				);
+
+			static uint16_t lookup(
+				__in void *context,
+				__in const char *field,
+				__in uint32_t length,
+				__in uint32_t hash,
+				__out_opt uint32_t *bucket = NULL
+				);
+
 			static void validate(
 				__in void *context
 				);
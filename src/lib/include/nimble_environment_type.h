@@ -31,7 +31,8 @@ namespace NIMBLE {
 	#endif // NDEBUG
 
 	enum {
-		NIMBLE_ENVIRONMENT_EXCEPTION_INVALID = 0,
+		NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED = 0,
+		NIMBLE_ENVIRONMENT_EXCEPTION_INVALID,
 		NIMBLE_ENVIRONMENT_EXCEPTION_NOT_FOUND,
 		NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES,
 	};
@@ -39,6 +40,7 @@ namespace NIMBLE {
 	#define NIMBLE_ENVIRONMENT_EXCEPTION_MAX NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES
 
 	static const std::string NIMBLE_ENVIRONMENT_EXCEPTION_STR[] = {
+		"Failed to allocate environment",
 		"Invalid environment",
 		"Environment entry does not exist",
 		"Environment is full",
@@ -20,10 +20,14 @@
 #ifndef NIMBLE_EXCEPTION_H_
 #define NIMBLE_EXCEPTION_H_
 
+#include <cstdarg>
+#include <map>
 #include <stdexcept>
 
 namespace NIMBLE {
 
+	#define DIAG_SOURCE_INVALID 0
+
 	#define EXCEPTION_HEADER "Exception"
 
 	#define UNKNOWN_EXCEPTION "Unknown exception"
@@ -36,6 +40,92 @@ namespace NIMBLE {
 		nimble_exception::generate(_HEAD_, _EXCEPT_, __FILE__, __LINE__, \
 		_FORMAT_, __VA_ARGS__)
 
+	#define THROW_EXCEPTION_DIAGNOSTIC(_HEAD_, _EXCEPT_, _CODE_, _DIAG_) \
+		nimble_exception::generate(_HEAD_, _EXCEPT_, __FILE__, __LINE__, \
+		_CODE_, _DIAG_, NULL)
+
+	#define THROW_EXCEPTION_DIAGNOSTIC_MESSAGE(_HEAD_, _EXCEPT_, _CODE_, _DIAG_, _FORMAT_, ...) \
+		nimble_exception::generate(_HEAD_, _EXCEPT_, __FILE__, __LINE__, \
+		_CODE_, _DIAG_, _FORMAT_, __VA_ARGS__)
+
+	typedef class _nimble_diagnostic {
+
+		public:
+
+			_nimble_diagnostic(
+				__in_opt uint32_t source = DIAG_SOURCE_INVALID,
+				__in_opt size_t offset = 0,
+				__in_opt size_t length = 0,
+				__in_opt uint32_t code = 0
+				);
+
+			_nimble_diagnostic(
+				__in const _nimble_diagnostic &other
+				);
+
+			virtual ~_nimble_diagnostic(void);
+
+			_nimble_diagnostic &operator=(
+				__in const _nimble_diagnostic &other
+				);
+
+			uint32_t code(void) const;
+
+			bool is_valid(void) const;
+
+			size_t length(void) const;
+
+			size_t offset(void) const;
+
+			std::string render(
+				__in_opt bool verbose = false
+				) const;
+
+			uint32_t source(void) const;
+
+			static uint32_t source_acquire(
+				__in const std::string &text,
+				__in_opt const std::string &path = std::string()
+				);
+
+			static void source_release(
+				__in uint32_t source
+				);
+
+			virtual std::string to_string(
+				__in_opt bool verbose = false
+				) const;
+
+		protected:
+
+			typedef struct {
+				std::string path;
+				size_t references;
+				std::string text;
+			} nimble_diagnostic_source;
+
+			static void _source_reference(
+				__in uint32_t source
+				);
+
+			uint32_t m_code;
+
+			size_t m_length;
+
+			size_t m_offset;
+
+			uint32_t m_source;
+
+			static std::map<uint32_t, nimble_diagnostic_source> m_source_map;
+
+			static uint32_t m_source_next;
+
+		private:
+
+			static nimble_lock_policy m_source_lock;
+
+	} nimble_diagnostic, *nimble_diagnostic_ptr;
+
 	typedef class _nimble_exception :
 			public std::runtime_error {
 
@@ -44,7 +134,8 @@ namespace NIMBLE {
 			_nimble_exception(
 				__in_opt const std::string &message = std::string(),
 				__in_opt const std::string &source = std::string(),
-				__in_opt size_t line = 0
+				__in_opt size_t line = 0,
+				__in_opt const nimble_diagnostic &diagnostic = nimble_diagnostic()
 				);
 
 			_nimble_exception(
@@ -66,6 +157,19 @@ namespace NIMBLE {
 				...
 				);
 
+			static void generate(
+				__in const std::string &header,
+				__in const std::string &message,
+				__in const std::string &source,
+				__in size_t line,
+				__in uint32_t code,
+				__in const nimble_diagnostic &diagnostic,
+				__in const char *format,
+				...
+				);
+
+			const nimble_diagnostic &diagnostic(void);
+
 			size_t &line(void);
 
 			std::string &source(void);
@@ -76,13 +180,18 @@ namespace NIMBLE {
 
 		protected:
 
-			size_t m_line;
+			static std::string _generate(
+				__in const std::string &header,
+				__in const std::string &message,
+				__in const char *format,
+				__in va_list arguments
+				);
 
-			std::string m_source;
+			nimble_diagnostic m_diagnostic;
 
-		private:
+			size_t m_line;
 
-			std::recursive_mutex m_lock;
+			std::string m_source;
 
 	} nimble_exception, *nimble_exception_ptr;
 }
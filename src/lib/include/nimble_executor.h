@@ -71,7 +71,8 @@ namespace NIMBLE {
 				std::string evaluate_statement_argument(
 					__in const nimble_statement &stmt,
 					__in_opt size_t parent = PAR_INVALID,
-					__inout_opt void *environment = NULL
+					__inout_opt void *environment = NULL,
+					__out_opt uint32_t *hash = NULL
 					);
 
 				size_t evaluate_statement_assignment(
@@ -98,12 +99,18 @@ namespace NIMBLE {
 				std::string evaluate_statement_literal(
 					__in const nimble_statement &stmt,
 					__in_opt size_t parent = PAR_INVALID,
-					__inout_opt void *environment = NULL
+					__inout_opt void *environment = NULL,
+					__out_opt uint32_t *hash = NULL
+					);
+
+				void time_publish(
+					__inout void *environment,
+					__in_opt uint64_t exec = 0
 					);
 
-			private:
+				uint64_t m_time_begin;
 
-				std::recursive_mutex m_lock;
+				uint64_t m_time_evaluate;
 
 		} nimble_executor, *nimble_executor_ptr;
 	}
@@ -0,0 +1,182 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_GENERATOR_H_
+#define NIMBLE_GENERATOR_H_
+
+namespace NIMBLE {
+
+	namespace LANGUAGE {
+
+		#define GEN_DEPTH_DEFAULT 4
+		#define GEN_REPEAT_MAX 4
+		#define GEN_SEED_DEFAULT 0x6e696d626c65ULL
+		#define GEN_WORDS_DEFAULT 6
+
+		enum {
+			GEN_MIX_ARGUMENT = 0,
+			GEN_MIX_ASSIGNMENT,
+			GEN_MIX_CALL_LIST,
+			GEN_MIX_COMMENT,
+			GEN_MIX_LITERAL,
+			GEN_MIX_NEST,
+			GEN_MIX_PIPE,
+			GEN_MIX_REDIRECT,
+			GEN_MIX_SEPERATOR,
+			GEN_MIX_STRING,
+		};
+
+		#define GEN_MIX_MAX GEN_MIX_STRING
+
+		enum {
+			GEN_START_ANY = 0,
+			GEN_START_CALL,
+			GEN_START_NEST,
+		};
+
+		#define GEN_START_MAX GEN_START_NEST
+
+		typedef class _nimble_generator {
+
+			public:
+
+				_nimble_generator(
+					__in_opt uint64_t seed = GEN_SEED_DEFAULT,
+					__in_opt size_t depth = GEN_DEPTH_DEFAULT,
+					__in_opt size_t words = GEN_WORDS_DEFAULT
+					);
+
+				_nimble_generator(
+					__in const _nimble_generator &other
+					);
+
+				virtual ~_nimble_generator(void);
+
+				_nimble_generator &operator=(
+					__in const _nimble_generator &other
+					);
+
+				size_t bytes(void);
+
+				size_t generate(
+					__inout std::ostream &stream,
+					__in size_t bytes,
+					__in_opt size_t statements = 0
+					);
+
+				std::string generate(
+					__in size_t statements
+					);
+
+				uint8_t &mix(
+					__in uint8_t type
+					);
+
+				static std::string mix_as_string(
+					__in uint8_t type
+					);
+
+				void reset(void);
+
+				size_t statements(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+				size_t tokens(void);
+
+			protected:
+
+				bool chance(
+					__in uint8_t type
+					);
+
+				void emit(
+					__in const std::string &text,
+					__in_opt size_t tokens = 1
+					);
+
+				void emit_argument(void);
+
+				void emit_assignment(void);
+
+				void emit_call(void);
+
+				void emit_call_list(void);
+
+				void emit_command_0(
+					__in size_t depth,
+					__in_opt uint8_t start = GEN_START_ANY
+					);
+
+				void emit_command_1(
+					__in size_t depth,
+					__in_opt uint8_t start = GEN_START_ANY
+					);
+
+				void emit_command_2(
+					__in size_t depth,
+					__in_opt uint8_t start = GEN_START_ANY
+					);
+
+				void emit_command_3(
+					__in size_t depth,
+					__in_opt uint8_t start = GEN_START_ANY
+					);
+
+				void emit_literal(void);
+
+				void emit_statement(void);
+
+				void emit_string(void);
+
+				void emit_word(void);
+
+				uint64_t next(void);
+
+				std::string m_buffer;
+
+				size_t m_bytes;
+
+				size_t m_depth;
+
+				size_t m_merged;
+
+				uint8_t m_mix[GEN_MIX_MAX + 1];
+
+				size_t m_nested;
+
+				bool m_open;
+
+				uint64_t m_seed;
+
+				uint64_t m_state;
+
+				size_t m_statements;
+
+				size_t m_tokens;
+
+				size_t m_words;
+
+		} nimble_generator, *nimble_generator_ptr;
+	}
+}
+
+#endif // NIMBLE_GENERATOR_H_
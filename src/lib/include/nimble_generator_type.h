@@ -0,0 +1,63 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_GENERATOR_TYPE_H_
+#define NIMBLE_GENERATOR_TYPE_H_
+
+namespace NIMBLE {
+
+	namespace LANGUAGE {
+
+		#define NIMBLE_GENERATOR_HEADER "Generator"
+
+		#ifndef NDEBUG
+		#define NIMBLE_GENERATOR_EXCEPTION_HEADER NIMBLE_GENERATOR_HEADER
+		#else
+		#define NIMBLE_GENERATOR_EXCEPTION_HEADER EXCEPTION_HEADER
+		#endif // NDEBUG
+
+		enum {
+			NIMBLE_GENERATOR_EXCEPTION_INVALID_MIX = 0,
+			NIMBLE_GENERATOR_EXCEPTION_INVALID_STREAM,
+		};
+
+		#define NIMBLE_GENERATOR_EXCEPTION_MAX NIMBLE_GENERATOR_EXCEPTION_INVALID_STREAM
+
+		static const std::string NIMBLE_GENERATOR_EXCEPTION_STR[] = {
+			"Invalid mix type",
+			"Invalid output stream",
+			};
+
+		#define NIMBLE_GENERATOR_EXCEPTION_STRING(_TYPE_) \
+			((_TYPE_) > NIMBLE_GENERATOR_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : \
+			CHK_STR(NIMBLE_GENERATOR_EXCEPTION_STR[_TYPE_]))
+
+		#define THROW_NIMBLE_GENERATOR_EXCEPTION(_EXCEPT_) \
+			THROW_EXCEPTION(NIMBLE_GENERATOR_EXCEPTION_HEADER, \
+			NIMBLE_GENERATOR_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_NIMBLE_GENERATOR_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...) \
+			THROW_EXCEPTION_MESSAGE(NIMBLE_GENERATOR_EXCEPTION_HEADER, \
+			NIMBLE_GENERATOR_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+		class _nimble_generator;
+		typedef _nimble_generator nimble_generator, *nimble_generator_ptr;
+	}
+}
+
+#endif // NIMBLE_GENERATOR_TYPE_H_
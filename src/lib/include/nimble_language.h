@@ -29,12 +29,24 @@ namespace NIMBLE {
 	#define CHAR_DIRECTORY_SEPERATOR_FOREWORD '/'
 	#define CHAR_END_OF_FILE '\0'
 	#define CHAR_FILL '~'
+	#define CHAR_JOB '%'
 	#define CHAR_LINE_FEED '\n'
 	#define CHAR_LITERAL_STRING_DELIMITER '\"'
+	#define CHAR_MODE '&'
+	#define CHAR_SEPERATOR ';'
 	#define CHAR_SPACE ' '
 	#define CHAR_TAB '\t'
 
+	#define CMD_BACKGROUND "bg"
 	#define CMD_EXIT "exit"
+	#define CMD_FOREGROUND "fg"
+	#define CMD_JOBS "jobs"
+	#define CMD_PARALLEL "parallel"
+	#define CMD_STATS "stats"
+	#define CMD_TIME "time"
+	#define CMD_TRACE "trace"
+	#define CMD_UNSET "unset"
+	#define CMD_WAIT "wait"
 
 	#define TOK_INVALID INVALID_TYPE(nimble_tok_t)
 	#define TOKSUB_INVALID INVALID_TYPE(nimble_subtok_t)
@@ -145,10 +157,6 @@ namespace NIMBLE {
 
 			size_t m_row_offset;
 
-		private:
-
-			std::recursive_mutex m_lock;
-
 	} nimble_token_meta, *nimble_token_meta_ptr;
 
 	typedef class _nimble_language {
@@ -68,6 +68,8 @@ namespace NIMBLE {
 
 				size_t character_column(void);
 
+				nimble_diagnostic character_diagnostic(void);
+
 				std::string character_exception(
 					__in_opt size_t tabs = 0,
 					__in_opt bool verbose = false
@@ -141,6 +143,8 @@ namespace NIMBLE {
 
 			protected:
 
+				uint32_t diagnostic_source(void);
+
 				std::map<size_t, std::pair<size_t, std::string>>::iterator find_line(
 					__in size_t row
 					);
@@ -159,14 +163,12 @@ namespace NIMBLE {
 
 				size_t m_char_row;
 
+				uint32_t m_diagnostic_source;
+
 				std::string m_path;
 
 				std::string m_source;
 
-			private:
-
-				std::recursive_mutex m_lock;
-
 		} nimble_lexer_base, *nimble_lexer_base_ptr;
 
 		typedef class _nimble_lexer :
@@ -229,11 +231,15 @@ namespace NIMBLE {
 
 				nimble_token &token_end(void);
 
+				nimble_diagnostic token_diagnostic(void);
+
 				std::string token_exception(
 					__in_opt size_t tabs = 0,
 					__in_opt bool verbose = false
 					);
 
+				static const nimble_stats &token_stats(void);
+
 			protected:
 
 				void enumerate_token(
@@ -256,15 +262,23 @@ namespace NIMBLE {
 
 				void skip_whitespace(void);
 
+				void update_token_stats(void);
+
 				static nimble_token_factory_ptr acquire_token(void);
 
+				uint64_t m_probe_begin;
+
+				uint64_t m_time_lex;
+
+				bool m_timed;
+
+				size_t m_tok_bytes;
+
 				std::vector<nimble_uid> m_tok_list;
 
 				size_t m_tok_position;
 
-			private:
-
-				std::recursive_mutex m_lock;
+				static nimble_stats m_tok_stats;
 
 		} nimble_lexer, *nimble_lexer_ptr;
 	}
@@ -72,6 +72,12 @@ namespace NIMBLE {
 			((_TYPE_) > NIMBLE_LEXER_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : \
 			CHK_STR(NIMBLE_LEXER_EXCEPTION_STR[_TYPE_]))
 
+		#define THROW_NIMBLE_LEXER_EXCEPTION_DIAGNOSTIC(_EXCEPT_, _DIAG_) \
+			THROW_EXCEPTION_DIAGNOSTIC(NIMBLE_LEXER_EXCEPTION_HEADER, \
+			NIMBLE_LEXER_EXCEPTION_STRING(_EXCEPT_), _EXCEPT_, _DIAG_)
+		#define THROW_NIMBLE_LEXER_EXCEPTION_DIAGNOSTIC_MESSAGE(_EXCEPT_, _DIAG_, _FORMAT_, ...) \
+			THROW_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_LEXER_EXCEPTION_HEADER, \
+			NIMBLE_LEXER_EXCEPTION_STRING(_EXCEPT_), _EXCEPT_, _DIAG_, _FORMAT_, __VA_ARGS__)
 		#define THROW_NIMBLE_LEXER_EXCEPTION(_EXCEPT_) \
 			THROW_EXCEPTION(NIMBLE_LEXER_EXCEPTION_HEADER, \
 			NIMBLE_LEXER_EXCEPTION_STRING(_EXCEPT_))
@@ -0,0 +1,102 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_LOCK_H_
+#define NIMBLE_LOCK_H_
+
+#include <atomic>
+#include <new>
+#include <pthread.h>
+
+namespace NIMBLE {
+
+	typedef class _nimble_lock_none {
+
+		public:
+
+			void lock(void)
+			{
+				return;
+			}
+
+			void unlock(void)
+			{
+				return;
+			}
+
+	} nimble_lock_none, *nimble_lock_none_ptr;
+
+	typedef class _nimble_lock_recursive {
+
+		public:
+
+			_nimble_lock_recursive(void) :
+				m_generation(_generation())
+			{
+				return;
+			}
+
+			void lock(void)
+			{
+
+				if(m_generation != _generation()) {
+					m_lock.~recursive_mutex();
+					new (&m_lock) std::recursive_mutex;
+					m_generation = _generation();
+				}
+
+				m_lock.lock();
+			}
+
+			void unlock(void)
+			{
+				m_lock.unlock();
+			}
+
+		protected:
+
+			static void _fork_child(void)
+			{
+				++_generation();
+			}
+
+			static std::atomic<uint32_t> &_generation(void)
+			{
+				static std::atomic<uint32_t> result(0);
+				static int registered = pthread_atfork(NULL, NULL, 
+					_nimble_lock_recursive::_fork_child);
+
+				REF_PARAM(registered);
+				return result;
+			}
+
+			uint32_t m_generation;
+
+			std::recursive_mutex m_lock;
+
+	} nimble_lock_recursive, *nimble_lock_recursive_ptr;
+
+	#ifdef NIMBLE_THREADED
+	typedef nimble_lock_recursive nimble_lock_policy;
+	#else
+	typedef nimble_lock_none nimble_lock_policy;
+	#endif // NIMBLE_THREADED
+}
+
+#endif // NIMBLE_LOCK_H_
@@ -20,13 +20,16 @@
 #ifndef NIMBLE_NODE_H_
 #define NIMBLE_NODE_H_
 
-#include <vector>
-
 namespace NIMBLE {
 
 	namespace COMPONENT {
 
-		#define PAR_INVALID INVALID_TYPE(size_t)
+		#define NODE_CHILDREN_INLINE 4
+		#define PAR_INVALID INVALID_TYPE(nimble_node_index_t)
+
+		typedef uint32_t nimble_node_index_t;
+
+		typedef nimble_small_vector<nimble_node_index_t, NODE_CHILDREN_INLINE> nimble_node_children;
 
 		typedef class _nimble_node :
 				public nimble_uid_class {
@@ -35,25 +38,33 @@ namespace NIMBLE {
 
 				_nimble_node(
 					__in_opt const nimble_uid &token = UID_INVALID,
-					__in_opt size_t parent = PAR_INVALID
+					__in_opt nimble_node_index_t parent = PAR_INVALID
 					);
 
 				_nimble_node(
 					__in const _nimble_node &other
 					);
 
+				_nimble_node(
+					__in _nimble_node &&other
+					);
+
 				virtual ~_nimble_node(void);
 
 				_nimble_node &operator=(
 					__in const _nimble_node &other
 					);
 
+				_nimble_node &operator=(
+					__in _nimble_node &&other
+					);
+
 				static std::string as_string(
 					__in const _nimble_node &node,
 					__in_opt bool verbose = false
 					);
 
-				std::vector<size_t> &children(void);
+				nimble_node_children &children(void);
 
 				virtual void clear(void);
 
@@ -61,7 +72,7 @@ namespace NIMBLE {
 
 				bool is_root(void);
 
-				size_t &parent(void);
+				nimble_node_index_t &parent(void);
 
 				virtual void set(
 					__in const nimble_uid &token
@@ -77,19 +88,17 @@ namespace NIMBLE {
 
 				static nimble_token_factory_ptr acquire_token(void);
 
-				std::vector<size_t> m_children;
+				nimble_node_children m_children;
 
-				size_t m_parent;
+				nimble_node_index_t m_parent;
 
-				nimble_uid m_token;
-
-			private:
-
-				std::recursive_mutex m_lock;
+				nimble_uid_t m_token;
 
 		} nimble_node, *nimble_node_ptr;
 
-		typedef class _nimble_node_factory {
+		typedef class _nimble_node_factory :
+				public nimble_object_factory<nimble_node, nimble_storage_pool<nimble_node>, 
+					nimble_lock_policy> {
 
 			public:
 
@@ -97,42 +106,8 @@ namespace NIMBLE {
 
 				static _nimble_node_factory *acquire(void);
 
-				nimble_node &at(
-					__in const nimble_uid &uid
-					);
-
-				bool contains(
-					__in const nimble_uid &uid
-					);
-
-				size_t decrement_reference(
-					__in const nimble_uid &uid
-					);
-
-				nimble_uid generate(void);
-
-				size_t increment_reference(
-					__in const nimble_uid &uid
-					);
-
-				void initialize(void);
-
 				static bool is_allocated(void);
 
-				bool is_initialized(void);
-
-				size_t reference_count(
-					__in const nimble_uid &uid
-					);
-
-				size_t size(void);
-
-				std::string to_string(
-					__in_opt bool verbose = false
-					);
-
-				void uninitialize(void);
-
 			protected:
 
 				_nimble_node_factory(void);
@@ -147,20 +122,8 @@ namespace NIMBLE {
 
 				static void _delete(void);
 
-				std::map<nimble_uid, std::pair<nimble_node, size_t>>::iterator find(
-					__in const nimble_uid &uid
-					);
-
-				bool m_initialized;
-
 				static _nimble_node_factory *m_instance;
 
-				std::map<nimble_uid, std::pair<nimble_node, size_t>> m_map;
-
-			private:
-
-				std::recursive_mutex m_lock;
-
 		} nimble_node_factory, *nimble_node_factory_ptr;
 	}
 }
@@ -0,0 +1,892 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_OBJECT_H_
+#define NIMBLE_OBJECT_H_
+
+#include <map>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "nimble_object_type.h"
+
+namespace NIMBLE {
+
+	namespace COMPONENT {
+
+		#define OBJ_MAP_NODE (4 * sizeof(void *))
+		#define OBJ_POOL_BLOCK 0x100
+		#define OBJ_SLOT_INVALID INVALID_TYPE(uint32_t)
+
+		template<class T> struct _nimble_object_entry {
+
+			T &object(void)
+			{
+				return *reinterpret_cast<T *>(&storage);
+			}
+
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+			size_t reference;
+
+			uint32_t next;
+		};
+
+		template<class T> using nimble_object_entry = _nimble_object_entry<T>;
+
+		template<class T> class _nimble_storage_map {
+
+			public:
+
+				typedef nimble_object_entry<T> entry_type;
+
+				_nimble_storage_map(void);
+
+				~_nimble_storage_map(void);
+
+				size_t bytes(void) const;
+
+				void clear(void);
+
+				entry_type *create(void);
+
+				void destroy(
+					__in entry_type *entry
+					);
+
+				void enumerate(
+					__out std::vector<entry_type *> &entries
+					);
+
+				entry_type *find(
+					__in nimble_uid_t uid
+					);
+
+				size_t size(void) const;
+
+			protected:
+
+				_nimble_storage_map(
+					__in const _nimble_storage_map &other
+					);
+
+				_nimble_storage_map &operator=(
+					__in const _nimble_storage_map &other
+					);
+
+				std::map<nimble_uid_t, entry_type *> m_map;
+		};
+
+		template<class T> using nimble_storage_map = _nimble_storage_map<T>;
+
+		template<class T> class _nimble_storage_pool {
+
+			public:
+
+				typedef nimble_object_entry<T> entry_type;
+
+				_nimble_storage_pool(void);
+
+				~_nimble_storage_pool(void);
+
+				size_t bytes(void) const;
+
+				void clear(void);
+
+				entry_type *create(void);
+
+				void destroy(
+					__in entry_type *entry
+					);
+
+				void enumerate(
+					__out std::vector<entry_type *> &entries
+					);
+
+				entry_type *find(
+					__in nimble_uid_t uid
+					);
+
+				size_t size(void) const;
+
+			protected:
+
+				_nimble_storage_pool(
+					__in const _nimble_storage_pool &other
+					);
+
+				_nimble_storage_pool &operator=(
+					__in const _nimble_storage_pool &other
+					);
+
+				entry_type *slot(
+					__in uint32_t position
+					);
+
+				std::vector<entry_type *> m_block;
+
+				uint32_t m_count;
+
+				uint32_t m_free;
+
+				std::vector<uint32_t> m_index;
+
+				size_t m_size;
+		};
+
+		template<class T> using nimble_storage_pool = _nimble_storage_pool<T>;
+
+		template<class T, class StoragePolicy = nimble_storage_pool<T>, 
+				class LockPolicy = nimble_lock_policy> class _nimble_object_factory {
+
+			public:
+
+				typedef typename StoragePolicy::entry_type entry_type;
+
+				_nimble_object_factory(
+					__in_opt const std::string &header = NIMBLE_OBJECT_HEADER
+					);
+
+				virtual ~_nimble_object_factory(void);
+
+				T &at(
+					__in const nimble_uid &uid
+					);
+
+				bool contains(
+					__in const nimble_uid &uid
+					);
+
+				size_t decrement_reference(
+					__in const nimble_uid &uid
+					);
+
+				nimble_uid generate(void);
+
+				size_t increment_reference(
+					__in const nimble_uid &uid
+					);
+
+				void initialize(void);
+
+				bool is_initialized(void);
+
+				size_t reference_count(
+					__in const nimble_uid &uid
+					);
+
+				size_t size(void);
+
+				const nimble_stats &stats(void);
+
+				std::string to_string(
+					__in_opt bool verbose = false
+					);
+
+				void uninitialize(void);
+
+			protected:
+
+				_nimble_object_factory(
+					__in const _nimble_object_factory &other
+					);
+
+				_nimble_object_factory &operator=(
+					__in const _nimble_object_factory &other
+					);
+
+				entry_type *find(
+					__in const nimble_uid &uid
+					);
+
+				std::string m_header;
+
+				bool m_initialized;
+
+				LockPolicy m_lock;
+
+				nimble_stats m_stats;
+
+				StoragePolicy m_storage;
+		};
+
+		template<class T, class StoragePolicy = nimble_storage_pool<T>, 
+				class LockPolicy = nimble_lock_policy> using nimble_object_factory 
+			= _nimble_object_factory<T, StoragePolicy, LockPolicy>;
+
+		template<class T> 
+		_nimble_storage_map<T>::_nimble_storage_map(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> 
+		_nimble_storage_map<T>::~_nimble_storage_map(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			clear();
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> size_t 
+		_nimble_storage_map<T>::bytes(void) const
+		{
+			size_t result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = (m_map.size() * (sizeof(entry_type) 
+				+ sizeof(typename std::map<nimble_uid_t, entry_type *>::value_type) 
+				+ OBJ_MAP_NODE));
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		template<class T> void 
+		_nimble_storage_map<T>::clear(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			while(!m_map.empty()) {
+				destroy(m_map.begin()->second);
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> typename _nimble_storage_map<T>::entry_type *
+		_nimble_storage_map<T>::create(void)
+		{
+			entry_type *result = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = new entry_type;
+
+			try {
+				new (&result->storage) T;
+			} catch(...) {
+				delete result;
+				throw;
+			}
+
+			result->next = OBJ_SLOT_INVALID;
+			result->reference = REF_INITIAL;
+
+			if(!m_map.insert(std::pair<nimble_uid_t, entry_type *>(result->object().uid(), 
+					result)).second) {
+				result->object().~T();
+				delete result;
+				result = NULL;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T> void 
+		_nimble_storage_map<T>::destroy(
+			__in entry_type *entry
+			)
+		{
+			nimble_uid_t uid;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			uid = entry->object().uid();
+			entry->object().~T();
+			m_map.erase(uid);
+			delete entry;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> void 
+		_nimble_storage_map<T>::enumerate(
+			__out std::vector<entry_type *> &entries
+			)
+		{
+			typename std::map<nimble_uid_t, entry_type *>::iterator iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			entries.clear();
+
+			for(iter = m_map.begin(); iter != m_map.end(); ++iter) {
+				entries.push_back(iter->second);
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> typename _nimble_storage_map<T>::entry_type *
+		_nimble_storage_map<T>::find(
+			__in nimble_uid_t uid
+			)
+		{
+			entry_type *result = NULL;
+			typename std::map<nimble_uid_t, entry_type *>::iterator iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			iter = m_map.find(uid);
+			if(iter != m_map.end()) {
+				result = iter->second;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T> size_t 
+		_nimble_storage_map<T>::size(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_map.size());
+			return m_map.size();
+		}
+
+		template<class T> 
+		_nimble_storage_pool<T>::_nimble_storage_pool(void) :
+			m_count(0),
+			m_free(OBJ_SLOT_INVALID),
+			m_size(0)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> 
+		_nimble_storage_pool<T>::~_nimble_storage_pool(void)
+		{
+			size_t iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			clear();
+
+			for(iter = 0; iter < m_block.size(); ++iter) {
+				delete [] m_block.at(iter);
+			}
+
+			m_block.clear();
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> size_t 
+		_nimble_storage_pool<T>::bytes(void) const
+		{
+			size_t result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = ((m_block.size() * OBJ_POOL_BLOCK * sizeof(entry_type))
+				+ (m_block.capacity() * sizeof(entry_type *))
+				+ (m_index.capacity() * sizeof(uint32_t)));
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		template<class T> void 
+		_nimble_storage_pool<T>::clear(void)
+		{
+			uint32_t position;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			for(position = 0; position < m_count; ++position) {
+
+				if(slot(position)->reference >= REF_INITIAL) {
+					destroy(slot(position));
+				}
+			}
+
+			m_count = 0;
+			m_free = OBJ_SLOT_INVALID;
+			m_index.clear();
+			m_size = 0;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> typename _nimble_storage_pool<T>::entry_type *
+		_nimble_storage_pool<T>::create(void)
+		{
+			uint32_t index, position;
+			entry_type *result = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(m_free != OBJ_SLOT_INVALID) {
+				position = m_free;
+				result = slot(position);
+				m_free = result->next;
+			} else if(m_count < OBJ_SLOT_INVALID) {
+
+				if(m_count == (m_block.size() * OBJ_POOL_BLOCK)) {
+					m_block.push_back(new entry_type[OBJ_POOL_BLOCK]);
+				}
+
+				position = m_count++;
+				result = slot(position);
+			} else {
+				TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+				return result;
+			}
+
+			try {
+				new (&result->storage) T;
+			} catch(...) {
+				result->reference = 0;
+				result->next = m_free;
+				m_free = position;
+				throw;
+			}
+
+			index = UID_INDEX(result->object().uid());
+			if((result->object().uid() == UID_INVALID)
+					|| ((index < m_index.size()) && (m_index.at(index) != OBJ_SLOT_INVALID))) {
+				result->object().~T();
+				result->reference = 0;
+				result->next = m_free;
+				m_free = position;
+				TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", NULL);
+				return NULL;
+			}
+
+			if(index >= m_index.size()) {
+				m_index.resize(index + 1, OBJ_SLOT_INVALID);
+			}
+
+			m_index.at(index) = position;
+			result->next = OBJ_SLOT_INVALID;
+			result->reference = REF_INITIAL;
+			++m_size;
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T> void 
+		_nimble_storage_pool<T>::destroy(
+			__in entry_type *entry
+			)
+		{
+			uint32_t index;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			index = UID_INDEX(entry->object().uid());
+			entry->object().~T();
+			entry->next = m_free;
+			entry->reference = 0;
+			m_free = m_index.at(index);
+			m_index.at(index) = OBJ_SLOT_INVALID;
+			--m_size;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> void 
+		_nimble_storage_pool<T>::enumerate(
+			__out std::vector<entry_type *> &entries
+			)
+		{
+			uint32_t position;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			entries.clear();
+
+			for(position = 0; position < m_count; ++position) {
+
+				if(slot(position)->reference >= REF_INITIAL) {
+					entries.push_back(slot(position));
+				}
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T> typename _nimble_storage_pool<T>::entry_type *
+		_nimble_storage_pool<T>::find(
+			__in nimble_uid_t uid
+			)
+		{
+			uint32_t index = UID_INDEX(uid);
+			entry_type *result = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if((index < m_index.size()) 
+					&& (m_index[index] != OBJ_SLOT_INVALID)) {
+				result = slot(m_index[index]);
+
+				if(result->object().uid() != uid) {
+					result = NULL;
+				}
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T> size_t 
+		_nimble_storage_pool<T>::size(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_size);
+			return m_size;
+		}
+
+		template<class T> typename _nimble_storage_pool<T>::entry_type *
+		_nimble_storage_pool<T>::slot(
+			__in uint32_t position
+			)
+		{
+			return &m_block[position / OBJ_POOL_BLOCK][position % OBJ_POOL_BLOCK];
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::_nimble_object_factory(
+			__in_opt const std::string &header
+			) :
+				m_header(header),
+				m_initialized(false)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::~_nimble_object_factory(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(m_initialized) {
+				_nimble_object_factory<T, StoragePolicy, LockPolicy>::uninitialize();
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> T &
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::at(
+			__in const nimble_uid &uid
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			T &result = find(uid)->object();
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> bool 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::contains(
+			__in const nimble_uid &uid
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = (m_storage.find(uid.uid()) != NULL);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> size_t 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::decrement_reference(
+			__in const nimble_uid &uid
+			)
+		{
+			size_t previous, result;
+			entry_type *entry = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			entry = find(uid);
+
+			result = --entry->reference;
+			if(result < REF_INITIAL) {
+				TRACE_MESSAGE(TRACE_INFORMATION, "Removing %s: %s", CHK_STR(m_header),
+					CHK_STR(nimble_uid::as_string(uid, true)));
+				previous = m_storage.bytes();
+				m_storage.destroy(entry);
+				m_stats.release();
+				m_stats.resize(previous, m_storage.bytes());
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> 
+		typename _nimble_object_factory<T, StoragePolicy, LockPolicy>::entry_type *
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::find(
+			__in const nimble_uid &uid
+			)
+		{
+			entry_type *result = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_storage.find(uid.uid());
+			if(!result) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_NOT_FOUND),
+					CHK_STR(nimble_uid::as_string(uid)));
+				THROW_NIMBLE_OBJECT_EXCEPTION_MESSAGE(m_header, NIMBLE_OBJECT_EXCEPTION_NOT_FOUND,
+					"%s", CHK_STR(nimble_uid::as_string(uid)));
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> nimble_uid 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::generate(void)
+		{
+			size_t previous;
+			entry_type *entry = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			previous = m_storage.bytes();
+
+			entry = m_storage.create();
+			if(!entry) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_ALLOCATION));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_ALLOCATION);
+			}
+
+			m_stats.allocate();
+			m_stats.resize(previous, m_storage.bytes());
+
+			TRACE_MESSAGE(TRACE_INFORMATION, "Generating new %s: %s", CHK_STR(m_header),
+				CHK_STR(entry->object().to_string(true)));
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", 
+				CHK_STR(nimble_uid::as_string(entry->object())));
+			return entry->object().uid();
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> size_t 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::increment_reference(
+			__in const nimble_uid &uid
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = ++find(uid)->reference;
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> void 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::initialize(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_INITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_INITIALIZED);
+			}
+
+			m_initialized = true;
+			m_storage.clear();
+			m_stats.reset();
+			m_stats.resize(0, m_storage.bytes());
+			TRACE_MESSAGE(TRACE_INFORMATION, "%s component instance initialized", 
+				CHK_STR(m_header));
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> bool 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::is_initialized(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_initialized);
+			return m_initialized;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> size_t 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::reference_count(
+			__in const nimble_uid &uid
+			)
+		{
+			size_t result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = find(uid)->reference;
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> size_t 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::size(void)
+		{
+			size_t result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			result = m_storage.size();
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> const nimble_stats &
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::stats(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &m_stats);
+			return m_stats;
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> std::string 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::to_string(
+			__in_opt bool verbose
+			)
+		{
+			size_t iter;
+			std::stringstream result;
+			std::vector<entry_type *> entries;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			result << "(" << (m_initialized ? "INIT" : "UNINIT") << ") " << m_header 
+				<< "[" << m_storage.size() << "]";
+
+			if(verbose) {
+				result << " (" << VAL_AS_HEX(void *, this) << ")";
+				m_storage.enumerate(entries);
+
+				for(iter = 0; iter < entries.size(); ++iter) {
+					result << std::endl << "--- " << T::as_string(entries.at(iter)->object(), true)
+						<< ", ref. " << entries.at(iter)->reference;
+				}
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
+			return CHK_STR(result.str());
+		}
+
+		template<class T, class StoragePolicy, class LockPolicy> void 
+		_nimble_object_factory<T, StoragePolicy, LockPolicy>::uninitialize(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_OBJECT_EXCEPTION_STRING(NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_OBJECT_EXCEPTION(m_header, NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED);
+			}
+
+			m_storage.clear();
+			m_stats.reset();
+			m_stats.resize(0, m_storage.bytes());
+			m_initialized = false;
+			TRACE_MESSAGE(TRACE_INFORMATION, "%s component instance uninitialized", 
+				CHK_STR(m_header));
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+	}
+}
+
+#endif // NIMBLE_OBJECT_H_
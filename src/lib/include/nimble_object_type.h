@@ -0,0 +1,58 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_OBJECT_TYPE_H_
+#define NIMBLE_OBJECT_TYPE_H_
+
+namespace NIMBLE {
+
+	namespace COMPONENT {
+
+		#define NIMBLE_OBJECT_HEADER "Object"
+
+		enum {
+			NIMBLE_OBJECT_EXCEPTION_ALLOCATION = 0,
+			NIMBLE_OBJECT_EXCEPTION_INITIALIZED,
+			NIMBLE_OBJECT_EXCEPTION_NOT_FOUND,
+			NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED,
+		};
+
+		#define NIMBLE_OBJECT_EXCEPTION_MAX NIMBLE_OBJECT_EXCEPTION_UNINITIALIZED
+
+		static const std::string NIMBLE_OBJECT_EXCEPTION_STR[] = {
+			"Failed to allocate object",
+			"Object component is initialized",
+			"Object does not exist",
+			"Object component is uninitialized",
+			};
+
+		#define NIMBLE_OBJECT_EXCEPTION_STRING(_TYPE_) \
+			((_TYPE_) > NIMBLE_OBJECT_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : \
+			CHK_STR(NIMBLE_OBJECT_EXCEPTION_STR[_TYPE_]))
+
+		#define THROW_NIMBLE_OBJECT_EXCEPTION(_HEADER_, _EXCEPT_) \
+			THROW_EXCEPTION(_HEADER_, \
+			NIMBLE_OBJECT_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_NIMBLE_OBJECT_EXCEPTION_MESSAGE(_HEADER_, _EXCEPT_, _FORMAT_, ...) \
+			THROW_EXCEPTION_MESSAGE(_HEADER_, \
+			NIMBLE_OBJECT_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+	}
+}
+
+#endif // NIMBLE_OBJECT_TYPE_H_
@@ -84,6 +84,8 @@ namespace NIMBLE {
 					__in_opt bool verbose = false
 					);
 
+				nimble_diagnostic statement_diagnostic(void);
+
 				std::string statement_exception(
 					__in_opt size_t tabs = 0,
 					__in_opt bool verbose = false
@@ -91,6 +93,8 @@ namespace NIMBLE {
 
 				size_t statement_position(void);
 
+				static const nimble_stats &statement_stats(void);
+
 				virtual std::string to_string(
 					__in_opt bool verbose = false
 					);
@@ -178,7 +182,7 @@ namespace NIMBLE {
 					);
 
 				void insert_statement(
-					__in const nimble_statement &stmt
+					__in nimble_statement &&stmt
 					);
 
 				static nimble_node &node(
@@ -189,13 +193,19 @@ namespace NIMBLE {
 					__in const nimble_uid &uid
 					);
 
+				void update_statement_stats(
+					__in size_t bytes
+					);
+
+				size_t m_stmt_bytes;
+
 				std::vector<nimble_statement> m_stmt_list;
 
 				size_t m_stmt_position;
 
-			private:
+				static nimble_stats m_stmt_stats;
 
-				std::recursive_mutex m_lock;
+				uint64_t m_time_parse;
 
 		} nimble_parser, *nimble_parser_ptr;
 	}
@@ -46,9 +46,10 @@ namespace NIMBLE {
 			NIMBLE_PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
 			NIMBLE_PARSER_EXCEPTION_NO_NEXT_STATEMENT,
 			NIMBLE_PARSER_EXCEPTION_NO_PREVIOUS_STATEMENT,
+			NIMBLE_PARSER_EXCEPTION_STATEMENT_TOO_LARGE,
 		};
 
-		#define NIMBLE_PARSER_EXCEPTION_MAX NIMBLE_PARSER_EXCEPTION_NO_PREVIOUS_STATEMENT
+		#define NIMBLE_PARSER_EXCEPTION_MAX NIMBLE_PARSER_EXCEPTION_STATEMENT_TOO_LARGE
 
 		static const std::string NIMBLE_PARSER_EXCEPTION_STR[] = {
 			"Node component is not ready",
@@ -64,12 +65,19 @@ namespace NIMBLE {
 			"Invalid statement position",
 			"No next statement is stream",
 			"No previous statement in stream",
+			"Statement exceeds node index range",
 			};
 
 		#define NIMBLE_PARSER_EXCEPTION_STRING(_TYPE_) \
 			((_TYPE_) > NIMBLE_PARSER_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : \
 			CHK_STR(NIMBLE_PARSER_EXCEPTION_STR[_TYPE_]))
 
+		#define THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(_EXCEPT_, _DIAG_) \
+			THROW_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_HEADER, \
+			NIMBLE_PARSER_EXCEPTION_STRING(_EXCEPT_), _EXCEPT_, _DIAG_)
+		#define THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC_MESSAGE(_EXCEPT_, _DIAG_, _FORMAT_, ...) \
+			THROW_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_PARSER_EXCEPTION_HEADER, \
+			NIMBLE_PARSER_EXCEPTION_STRING(_EXCEPT_), _EXCEPT_, _DIAG_, _FORMAT_, __VA_ARGS__)
 		#define THROW_NIMBLE_PARSER_EXCEPTION(_EXCEPT_) \
 			THROW_EXCEPTION(NIMBLE_PARSER_EXCEPTION_HEADER, \
 			NIMBLE_PARSER_EXCEPTION_STRING(_EXCEPT_))
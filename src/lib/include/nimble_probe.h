@@ -0,0 +1,99 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_PROBE_H_
+#define NIMBLE_PROBE_H_
+
+#include <cstdint>
+#include <time.h>
+
+#if !defined(NPROBE) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define NIMBLE_PROBE_ENABLED
+#endif // __has_include(<sys/sdt.h>)
+#endif // !defined(NPROBE) && defined(__has_include)
+
+#ifdef NIMBLE_PROBE_ENABLED
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#endif // NIMBLE_PROBE_ENABLED
+
+namespace NIMBLE {
+
+	#define PROBE_PROVIDER nimble
+	#define PROBE_SEMAPHORE(_NAME_) nimble_##_NAME_##_semaphore
+
+	#ifdef NIMBLE_PROBE_ENABLED
+	#define PROBE_DECLARE(_NAME_) \
+		extern "C" volatile unsigned short PROBE_SEMAPHORE(_NAME_)
+	#define PROBE_DEFINE(_NAME_) \
+		extern "C" { \
+			volatile unsigned short PROBE_SEMAPHORE(_NAME_) \
+				__attribute__((section(".probes"), used)) = 0; \
+		}
+	#define PROBE_ACTIVE(_NAME_) __builtin_expect(!!PROBE_SEMAPHORE(_NAME_), 0)
+	#define PROBE1(_NAME_, _ARG0_) \
+		DTRACE_PROBE1(PROBE_PROVIDER, _NAME_, _ARG0_)
+	#define PROBE2(_NAME_, _ARG0_, _ARG1_) \
+		DTRACE_PROBE2(PROBE_PROVIDER, _NAME_, _ARG0_, _ARG1_)
+	#define PROBE3(_NAME_, _ARG0_, _ARG1_, _ARG2_) \
+		DTRACE_PROBE3(PROBE_PROVIDER, _NAME_, _ARG0_, _ARG1_, _ARG2_)
+	#define PROBE_ELAPSED(_NAME_, _BEGIN_) \
+		((PROBE_ACTIVE(_NAME_) && (_BEGIN_)) ? (nimble_probe::now() - (_BEGIN_)) : 0)
+	#define PROBE_TIME(_NAME_) (PROBE_ACTIVE(_NAME_) ? nimble_probe::now() : 0)
+	#else
+	#define PROBE_DECLARE(_NAME_)
+	#define PROBE_DEFINE(_NAME_)
+	#define PROBE_ACTIVE(_NAME_) false
+	#define PROBE1(_NAME_, _ARG0_) ((void) sizeof(_ARG0_))
+	#define PROBE2(_NAME_, _ARG0_, _ARG1_) \
+		((void) sizeof(_ARG0_), (void) sizeof(_ARG1_))
+	#define PROBE3(_NAME_, _ARG0_, _ARG1_, _ARG2_) \
+		((void) sizeof(_ARG0_), (void) sizeof(_ARG1_), (void) sizeof(_ARG2_))
+	#define PROBE_ELAPSED(_NAME_, _BEGIN_) ((void) (_BEGIN_), 0)
+	#define PROBE_TIME(_NAME_) 0
+	#endif // NIMBLE_PROBE_ENABLED
+
+	PROBE_DECLARE(exec);
+	PROBE_DECLARE(fork);
+	PROBE_DECLARE(lex__end);
+	PROBE_DECLARE(lex__start);
+	PROBE_DECLARE(line__read);
+	PROBE_DECLARE(parse__end);
+	PROBE_DECLARE(parse__start);
+	PROBE_DECLARE(statement__end);
+	PROBE_DECLARE(statement__start);
+	PROBE_DECLARE(wait__done);
+
+	typedef class _nimble_probe {
+
+		public:
+
+			static inline uint64_t now(void)
+			{
+				struct timespec time;
+
+				clock_gettime(CLOCK_MONOTONIC, &time);
+				return (((uint64_t) time.tv_sec) * 1000000000ULL) + time.tv_nsec;
+			}
+
+	} nimble_probe, *nimble_probe_ptr;
+}
+
+#endif // NIMBLE_PROBE_H_
@@ -0,0 +1,94 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_STATS_H_
+#define NIMBLE_STATS_H_
+
+#include <atomic>
+#include <chrono>
+
+namespace NIMBLE {
+
+	typedef class _nimble_stats {
+
+		public:
+
+			_nimble_stats(void);
+
+			~_nimble_stats(void);
+
+			void allocate(void);
+
+			static std::string as_string(
+				__in const std::string &name,
+				__in const _nimble_stats &stats,
+				__in_opt bool json = false
+				);
+
+			size_t bytes(void) const;
+
+			double churn(void) const;
+
+			size_t created(void) const;
+
+			double elapsed(void) const;
+
+			static std::string header(void);
+
+			size_t live(void) const;
+
+			size_t peak(void) const;
+
+			void release(void);
+
+			size_t released(void) const;
+
+			void reset(void);
+
+			void resize(
+				__in size_t previous,
+				__in size_t current
+				);
+
+		protected:
+
+			_nimble_stats(
+				__in const _nimble_stats &other
+				);
+
+			_nimble_stats &operator=(
+				__in const _nimble_stats &other
+				);
+
+			std::chrono::steady_clock::time_point m_begin;
+
+			std::atomic<size_t> m_bytes;
+
+			std::atomic<size_t> m_created;
+
+			std::atomic<size_t> m_live;
+
+			std::atomic<size_t> m_peak;
+
+			std::atomic<size_t> m_released;
+
+	} nimble_stats, *nimble_stats_ptr;
+}
+
+#endif // NIMBLE_STATS_H_
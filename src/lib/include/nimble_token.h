@@ -35,12 +35,20 @@ namespace NIMBLE {
 					__in const _nimble_token &other
 					);
 
+				_nimble_token(
+					__in _nimble_token &&other
+					);
+
 				virtual ~_nimble_token(void);
 
 				_nimble_token &operator=(
 					__in const _nimble_token &other
 					);
 
+				_nimble_token &operator=(
+					__in _nimble_token &&other
+					);
+
 				static std::string as_string(
 					__in const _nimble_token &tok,
 					__in_opt bool verbose = false
@@ -50,6 +58,8 @@ namespace NIMBLE {
 
 				size_t &column(void);
 
+				uint32_t &hash(void);
+
 				nimble_token_meta meta(
 					__in_opt size_t column = 0,
 					__in_opt size_t row = 0
@@ -77,6 +87,8 @@ namespace NIMBLE {
 
 				size_t m_column;
 
+				uint32_t m_hash;
+
 				std::string m_path;
 
 				size_t m_position;
@@ -91,13 +103,11 @@ namespace NIMBLE {
 
 				double m_value;
 
-			private:
-
-				std::recursive_mutex m_lock;
-
 		} nimble_token, *nimble_token_ptr;
 
-		typedef class _nimble_token_factory {
+		typedef class _nimble_token_factory :
+				public nimble_object_factory<nimble_token, nimble_storage_pool<nimble_token>, 
+					nimble_lock_policy> {
 
 			public:
 
@@ -105,42 +115,8 @@ namespace NIMBLE {
 
 				static _nimble_token_factory *acquire(void);
 
-				nimble_token &at(
-					__in const nimble_uid &uid
-					);
-
-				bool contains(
-					__in const nimble_uid &uid
-					);
-
-				size_t decrement_reference(
-					__in const nimble_uid &uid
-					);
-
-				nimble_uid generate(void);
-
-				size_t increment_reference(
-					__in const nimble_uid &uid
-					);
-
-				void initialize(void);
-
 				static bool is_allocated(void);
 
-				bool is_initialized(void);
-
-				size_t reference_count(
-					__in const nimble_uid &uid
-					);
-
-				size_t size(void);
-
-				std::string to_string(
-					__in_opt bool verbose = false
-					);
-
-				void uninitialize(void);
-
 			protected:
 
 				_nimble_token_factory(void);
@@ -155,20 +131,8 @@ namespace NIMBLE {
 
 				static void _delete(void);
 
-				std::map<nimble_uid, std::pair<nimble_token, size_t>>::iterator find(
-					__in const nimble_uid &uid
-					);
-
-				bool m_initialized;
-
 				static _nimble_token_factory *m_instance;
 
-				std::map<nimble_uid, std::pair<nimble_token, size_t>> m_map;
-
-			private:
-
-				std::recursive_mutex m_lock;
-
 		} nimble_token_factory, *nimble_token_factory_ptr;
 	}
 }
@@ -20,7 +20,11 @@
 #ifndef NIMBLE_TRACE_H_
 #define NIMBLE_TRACE_H_
 
+#include <atomic>
+#include <cstring>
 #include <fstream>
+#include <type_traits>
+#include <vector>
 
 namespace NIMBLE {
 
@@ -34,6 +38,27 @@ namespace NIMBLE {
 
 	#define NIMBLE_LEVEL_MAX TRACE_VERBOSE
 
+	enum {
+		TRACE_COMPONENT_GENERAL = 0,
+		TRACE_COMPONENT_COMMAND,
+		TRACE_COMPONENT_EXECUTOR,
+		TRACE_COMPONENT_FACTORY,
+		TRACE_COMPONENT_LEXER,
+		TRACE_COMPONENT_PARSER,
+	};
+
+	#define TRACE_COMPONENT_ALL INVALID_TYPE(uint32_t)
+	#define TRACE_COMPONENT_MAX TRACE_COMPONENT_PARSER
+	#define TRACE_MASK_BIT(_COMPONENT_, _LEVEL_) \
+		(((uint32_t) 1) << (((_COMPONENT_) * (NIMBLE_LEVEL_MAX + 1)) + (_LEVEL_)))
+	#define TRACE_MASK_PROFILE (((uint32_t) 1) << 31)
+
+	enum {
+		TRACE_PROFILE_NONE = 0,
+		TRACE_PROFILE_ENTRY,
+		TRACE_PROFILE_EXIT,
+	};
+
 	#ifndef TLEVEL
 	#define TLEVEL TRACE_VERBOSE
 	#endif // TLEVEL
@@ -42,67 +67,258 @@ namespace NIMBLE {
 	#define TLOGOUT "log"
 	#endif // TLOGOUT
 
-	#ifndef NDEBUG
+	#ifdef NDEBUG
+	#define TRACE_LEVEL_DEF TRACE_NONE
+	#else
+	#define TRACE_LEVEL_DEF (TLEVEL)
+	#endif // NDEBUG
+
 	#define TRACE_HEADER_ENTRY "+"
 	#define TRACE_HEADER_EXIT "-"
+	#define TRACE_HEADER_MESSAGE ""
+
+	#ifndef NTRACE
+	#define TRACE_COLD __attribute__((cold, noinline))
+	#define TRACE_LEVEL_MAX \
+		(((TLEVEL) > NIMBLE_LEVEL_MAX) ? NIMBLE_LEVEL_MAX : (TLEVEL))
 	#define TRACE_PATH_DEF "."
-	#define _TRACE(_LEVEL_, _HEADER_) {\
-		if(((TLEVEL) > TRACE_NONE) && ((TLEVEL) >= (_LEVEL_))) { \
-		nimble_trace::generate(_LEVEL_, _HEADER_, __FUNCTION__, \
-		__FILE__, __LINE__, NULL); \
+	#define _TRACE_BIT(_LEVEL_) \
+		std::integral_constant<uint32_t, TRACE_MASK_BIT( \
+		nimble_trace::component(__FILE__), _LEVEL_)>::value
+	#define _TRACE_ENABLED(_LEVEL_, _PROFILE_) \
+		(((TLEVEL) > TRACE_NONE) && ((TLEVEL) >= (_LEVEL_)) \
+		&& nimble_trace::is_enabled(_TRACE_BIT(_LEVEL_) \
+		| (((_PROFILE_) != TRACE_PROFILE_NONE) ? TRACE_MASK_PROFILE : 0)))
+	#define _TRACE_PROFILE(_PROFILE_) \
+		if(((_PROFILE_) != TRACE_PROFILE_NONE) \
+		&& nimble_trace::is_enabled(TRACE_MASK_PROFILE)) { \
+		static nimble_trace_profile *const __profile = \
+		nimble_trace::profile_site(__site, _PROFILE_); \
+		nimble_trace::profile(__profile, __funct); \
+		}
+	#define _TRACE(_LEVEL_, _HEADER_, _PROFILE_) {\
+		if(_TRACE_ENABLED(_LEVEL_, _PROFILE_)) { \
+		[&](const char *__funct) TRACE_COLD { \
+		static const uint32_t __site = nimble_trace::site(_LEVEL_, _HEADER_, \
+		__funct, __FILE__, __LINE__, NULL); \
+		_TRACE_PROFILE(_PROFILE_); \
+		if(nimble_trace::is_enabled(_TRACE_BIT(_LEVEL_))) { \
+		nimble_trace::generate(__site); \
+		} \
+		}(__FUNCTION__); \
 		} \
 		}
-	#define _TRACE_MESSAGE(_LEVEL_, _HEADER_, _FORMAT_, ...) { \
-		if(((TLEVEL) > TRACE_NONE) && ((TLEVEL) >= (_LEVEL_))) { \
-		nimble_trace::generate(_LEVEL_, _HEADER_, __FUNCTION__, \
-		__FILE__, __LINE__, _FORMAT_, __VA_ARGS__); \
+	#define _TRACE_MESSAGE(_LEVEL_, _HEADER_, _PROFILE_, _FORMAT_, ...) { \
+		if(_TRACE_ENABLED(_LEVEL_, _PROFILE_)) { \
+		[&](const char *__funct) TRACE_COLD { \
+		static const uint32_t __site = nimble_trace::site(_LEVEL_, _HEADER_, \
+		__funct, __FILE__, __LINE__, _FORMAT_); \
+		_TRACE_PROFILE(_PROFILE_); \
+		if(nimble_trace::is_enabled(_TRACE_BIT(_LEVEL_))) { \
+		nimble_trace::generate(__site, __VA_ARGS__); \
+		} \
+		}(__FUNCTION__); \
 		} \
 		}
-	#define TRACE_ENTRY(_LEVEL_) _TRACE(_LEVEL_, TRACE_HEADER_ENTRY)
+	#define TRACE_ENTRY(_LEVEL_) _TRACE(_LEVEL_, TRACE_HEADER_ENTRY, TRACE_PROFILE_ENTRY)
 	#define TRACE_ENTRY_MESSAGE(_LEVEL_, _FORMAT_, ...) \
-		_TRACE_MESSAGE(_LEVEL_, TRACE_HEADER_ENTRY, _FORMAT_, \
+		_TRACE_MESSAGE(_LEVEL_, TRACE_HEADER_ENTRY, TRACE_PROFILE_ENTRY, _FORMAT_, \
 		__VA_ARGS__)
-	#define TRACE_EXIT(_LEVEL_) _TRACE(_LEVEL_, TRACE_HEADER_EXIT)
+	#define TRACE_EXIT(_LEVEL_) _TRACE(_LEVEL_, TRACE_HEADER_EXIT, TRACE_PROFILE_EXIT)
 	#define TRACE_EXIT_MESSAGE(_LEVEL_, _FORMAT_, ...) \
-		_TRACE_MESSAGE(_LEVEL_, TRACE_HEADER_EXIT, _FORMAT_, \
+		_TRACE_MESSAGE(_LEVEL_, TRACE_HEADER_EXIT, TRACE_PROFILE_EXIT, _FORMAT_, \
 		__VA_ARGS__)
+	#define TRACE_FLUSH() nimble_trace::flush()
 	#define TRACE_MESSAGE(_LEVEL_, _FORMAT_, ...) \
-		_TRACE_MESSAGE(_LEVEL_, std::string(), _FORMAT_, \
+		_TRACE_MESSAGE(_LEVEL_, TRACE_HEADER_MESSAGE, TRACE_PROFILE_NONE, _FORMAT_, \
 		__VA_ARGS__)
-	#define TRACE_START() nimble_trace::start(TLEVEL, TRACE_PATH_DEF, TLOGOUT)
-	#define TRACE_START_PATH(_PATH_) nimble_trace::start(TLEVEL, _PATH_, TLOGOUT)
+	#define TRACE_START() nimble_trace::start(TRACE_LEVEL_DEF, TRACE_PATH_DEF, TLOGOUT)
+	#define TRACE_START_PATH(_PATH_) nimble_trace::start(TRACE_LEVEL_DEF, _PATH_, TLOGOUT)
 	#define TRACE_STARTED() nimble_trace::is_started()
 	#define TRACE_STOP() nimble_trace::stop()
 	#else
-	#define _TRACE(_LEVEL_, _HEADER_)
-	#define _TRACE_MESSAGE(_LEVEL_, _HEADER_, _FORMAT_, ...)
+	#define _TRACE(_LEVEL_, _HEADER_, _PROFILE_)
+	#define _TRACE_MESSAGE(_LEVEL_, _HEADER_, _PROFILE_, _FORMAT_, ...)
 	#define TRACE_ENTRY(_LEVEL_)
 	#define TRACE_ENTRY_MESSAGE(_LEVEL_, _FORMAT_, ...)
 	#define TRACE_EXIT(_LEVEL_)
 	#define TRACE_EXIT_MESSAGE(_LEVEL_, _FORMAT_, ...)
+	#define TRACE_FLUSH()
+	#define TRACE_LEVEL_MAX TRACE_NONE
 	#define TRACE_MESSAGE(_LEVEL_, _FORMAT_, ...)
 	#define TRACE_START()
 	#define TRACE_START_PATH(_PATH_)
 	#define TRACE_STARTED()
 	#define TRACE_STOP()
-	#endif
+	#endif // NTRACE
+
+	#define TRACE_FLUSH_INTERVAL 10
+	#define TRACE_LEVEL_PROFILE TRACE_VERBOSE
+	#define TRACE_PROFILE_BUCKETS 0x100
+	#define TRACE_PROFILE_SUB_BITS 2
+	#define TRACE_RECORD_LEN 0x80
+	#define TRACE_RECORD_PAYLOAD (TRACE_RECORD_LEN - 16)
+	#define TRACE_RING_LINE 0x40
+	#define TRACE_RING_SLOTS 0x8000
+
+	enum {
+		TRACE_ARG_DOUBLE = 0,
+		TRACE_ARG_POINTER,
+		TRACE_ARG_SIGNED,
+		TRACE_ARG_STRING,
+		TRACE_ARG_UNSIGNED,
+	};
+
+	typedef struct {
+		uint64_t time;
+		uint32_t site;
+		uint16_t length;
+		uint16_t truncated;
+		uint8_t payload[TRACE_RECORD_PAYLOAD];
+	} nimble_trace_record;
+
+	typedef struct {
+		uint32_t id;
+		nimble_lvl_t level;
+		std::string header;
+		std::string funct;
+		std::string source;
+		size_t line;
+		std::string format;
+		bool has_format;
+	} nimble_trace_site;
+
+	typedef struct {
+		std::atomic<uint64_t> bucket[TRACE_PROFILE_BUCKETS];
+		std::atomic<uint64_t> count;
+		std::atomic<uint64_t> max;
+		uint32_t site;
+		std::atomic<uint64_t> total;
+	} nimble_trace_profile;
+
+	typedef struct alignas(TRACE_RING_LINE) {
+		alignas(TRACE_RING_LINE) std::atomic<uint64_t> head;
+		alignas(TRACE_RING_LINE) std::atomic<uint64_t> tail;
+		std::atomic<uint64_t> dropped;
+		uint32_t id;
+		std::atomic<bool> owned;
+		nimble_trace_record slot[TRACE_RING_SLOTS];
+	} nimble_trace_ring;
 
 	typedef class _nimble_trace {
 
 		public:
 
-			static void generate(
-				__in nimble_lvl_t level,
-				__in const std::string &header,
-				__in const std::string &funct,
-				__in const std::string &source,
-				__in size_t line,
-				__in const char *format,
-				...
+			static constexpr uint32_t component(
+				__in const char *source
+				)
+			{
+				return (_contains(source, "nimble_command") ? TRACE_COMPONENT_COMMAND
+					: (_contains(source, "nimble_executor") ? TRACE_COMPONENT_EXECUTOR
+					: ((_contains(source, "nimble_node") || _contains(source, "nimble_object")
+						|| _contains(source, "nimble_token") || _contains(source, "nimble_uid"))
+						? TRACE_COMPONENT_FACTORY
+					: (_contains(source, "nimble_lexer") ? TRACE_COMPONENT_LEXER
+					: (_contains(source, "nimble_parser") ? TRACE_COMPONENT_PARSER
+					: TRACE_COMPONENT_GENERAL)))));
+			}
+
+			static uint32_t component(
+				__in const std::string &name
+				);
+
+			static std::string component_as_string(
+				__in uint32_t component
+				);
+
+			static void decode(
+				__in const std::string &path,
+				__out std::ostream &stream
 				);
 
+			static void export_chrome(
+				__in const std::vector<std::string> &path,
+				__out std::ostream &stream
+				);
+
+			static void flush(void);
+
+			template<class... A> static void generate(
+				__in uint32_t site,
+				__in const A &... arguments
+				)
+			{
+				nimble_trace_record *record = NULL;
+
+				if(m_started.load(std::memory_order_relaxed) || _activate()) {
+
+					record = _reserve();
+					if(record) {
+						record->length = 0;
+						record->site = site;
+						record->time = _now();
+						record->truncated = 0;
+						_encode_arguments(*record, arguments...);
+						_commit();
+					}
+				}
+			}
+
+			static inline bool is_enabled(
+				__in uint32_t bit
+				)
+			{
+				return __builtin_expect(!!(m_mask.load(std::memory_order_relaxed) & bit), 0);
+			}
+
+			static bool is_profiling(void);
+
 			static bool is_started(void);
 
+			static nimble_lvl_t level(
+				__in_opt uint32_t component = TRACE_COMPONENT_GENERAL
+				);
+
+			static nimble_lvl_t level(
+				__in const std::string &name
+				);
+
+			static std::string level_as_string(void);
+
+			static nimble_lvl_t level_max(void);
+
+			static void profile(
+				__in nimble_trace_profile *entry,
+				__in const char *funct
+				);
+
+			static std::string profile_as_string(void);
+
+			static void profile_reset(void);
+
+			static nimble_trace_profile *profile_site(
+				__in uint32_t site,
+				__in uint32_t type
+				);
+
+			static void set_level(
+				__in nimble_lvl_t level,
+				__in_opt uint32_t component = TRACE_COMPONENT_ALL
+				);
+
+			static void set_profile(
+				__in bool enabled
+				);
+
+			static uint32_t site(
+				__in nimble_lvl_t level,
+				__in const char *header,
+				__in const char *funct,
+				__in const char *source,
+				__in size_t line,
+				__in const char *format
+				);
+
 			static void start(
 				__in nimble_lvl_t level,
 				__in const std::string &path,
@@ -113,11 +329,138 @@ namespace NIMBLE {
 
 		protected:
 
+			static bool _activate(void);
+
+			static void _commit(void);
+
+			static constexpr bool _contains(
+				__in const char *source,
+				__in const char *name
+				)
+			{
+				return (*source && (_prefix(source, name) || _contains(source + 1, name)));
+			}
+
+			static void _encode(
+				__inout nimble_trace_record &record,
+				__in const char *value
+				);
+
+			static void _encode(
+				__inout nimble_trace_record &record,
+				__in const std::string &value
+				);
+
+			static void _encode(
+				__inout nimble_trace_record &record,
+				__in double value
+				);
+
+			template<class T> static typename std::enable_if<std::is_integral<T>::value 
+					|| std::is_enum<T>::value>::type _encode(
+				__inout nimble_trace_record &record,
+				__in T value
+				)
+			{
+
+				if(std::is_signed<T>::value) {
+					_encode_value(record, TRACE_ARG_SIGNED, (int64_t) value);
+				} else {
+					_encode_value(record, TRACE_ARG_UNSIGNED, (uint64_t) value);
+				}
+			}
+
+			template<class T> static void _encode(
+				__inout nimble_trace_record &record,
+				__in const T *value
+				)
+			{
+				_encode_value(record, TRACE_ARG_POINTER, (uint64_t) (uintptr_t) value);
+			}
+
+			static void _encode_arguments(
+				__inout nimble_trace_record &record
+				);
+
+			template<class T, class... A> static void _encode_arguments(
+				__inout nimble_trace_record &record,
+				__in const T &value,
+				__in const A &... arguments
+				)
+			{
+				_encode(record, value);
+				_encode_arguments(record, arguments...);
+			}
+
+			template<class T> static void _encode_value(
+				__inout nimble_trace_record &record,
+				__in uint8_t type,
+				__in T value
+				)
+			{
+
+				if((record.length + sizeof(uint8_t) + sizeof(T)) > TRACE_RECORD_PAYLOAD) {
+					record.truncated = 1;
+				} else {
+					record.payload[record.length++] = type;
+					std::memcpy(&record.payload[record.length], &value, sizeof(T));
+					record.length += sizeof(T);
+				}
+			}
+
+			static void _flush(void);
+
+			static void _fork_child(void);
+
+			static uint64_t _now(void);
+
+			static constexpr bool _prefix(
+				__in const char *source,
+				__in const char *name
+				)
+			{
+				return (!*name || ((*source == *name) && _prefix(source + 1, name + 1)));
+			}
+
+			static nimble_trace_record *_reserve(void);
+
+			static std::vector<nimble_trace_ring *> &_ring_list(void);
+
+			static std::vector<nimble_trace_profile *> &_profile_list(void);
+
+			static void _run(void);
+
+			static std::vector<nimble_trace_site> &_site_list(void);
+
+			static void _write(
+				__in const std::string &buffer
+				);
+
+			static void _write_header(void);
+
+			static int m_file;
+
+			static std::thread *m_flusher;
+
+			static std::atomic<bool> m_forked;
+
 			static std::mutex m_lock;
 
-			static bool m_started;
+			static std::atomic<uint32_t> m_mask;
+
+			static std::string m_output;
+
+			static std::string m_path;
+
+			static std::atomic<bool> m_pending;
+
+			static pid_t m_pid;
+
+			static thread_local nimble_trace_ring *m_ring;
+
+			static size_t m_site_written;
 
-			static std::ofstream m_stream;
+			static std::atomic<bool> m_started;
 
 	} nimble_trace, *nimble_trace_ptr;
 }
@@ -20,8 +20,7 @@
 #ifndef NIMBLE_UID_H_
 #define NIMBLE_UID_H_
 
-#include <map>
-#include <set>
+#include <vector>
 
 namespace NIMBLE {
 
@@ -31,6 +30,19 @@ namespace NIMBLE {
 
 		#define UID_INVALID INVALID_TYPE(nimble_uid_t)
 
+		#define UID_GENERATION(_UID_) ((uint32_t) ((_UID_) >> UID_GENERATION_SHIFT))
+
+		#define UID_GENERATION_SHIFT 32
+
+		#define UID_INDEX(_UID_) ((uint32_t) (_UID_))
+
+		#define UID_MAKE(_INDEX_, _GENERATION_) \
+			((((nimble_uid_t) (_GENERATION_)) << UID_GENERATION_SHIFT) | (_INDEX_))
+
+		#define UID_SLOT_INVALID INVALID_TYPE(uint32_t)
+
+		#define UID_SLOT_MAX (UID_SLOT_INVALID - 1)
+
 		typedef uintmax_t nimble_uid_t;
 
 		typedef class _nimble_uid {
@@ -72,8 +84,12 @@ namespace NIMBLE {
 
 				nimble_uid_t &uid(void);
 
+				nimble_uid_t uid(void) const;
+
 			protected:
 
+				friend class _nimble_uid_factory;
+
 				friend bool operator<(
 					__in const _nimble_uid &left,
 					__in const _nimble_uid &right
@@ -81,10 +97,6 @@ namespace NIMBLE {
 
 				nimble_uid_t m_uid;
 
-			private:
-
-				std::recursive_mutex m_lock;
-
 		} nimble_uid, *nimble_uid_ptr;
 
 		bool operator<(
@@ -128,6 +140,8 @@ namespace NIMBLE {
 
 				size_t size(void);
 
+				const nimble_stats &stats(void);
+
 				std::string to_string(
 					__in_opt bool verbose = false
 					);
@@ -146,25 +160,33 @@ namespace NIMBLE {
 					__in const _nimble_uid_factory &other
 					);
 
+				typedef struct {
+					size_t reference;
+					uint32_t generation;
+					uint32_t next;
+				} nimble_uid_slot;
+
 				static void _delete(void);
 
-				std::map<nimble_uid, size_t>::iterator find(
+				nimble_uid_slot &find(
 					__in const nimble_uid &uid
 					);
 
+				uint32_t m_free;
+
 				bool m_initialized;
 
 				static _nimble_uid_factory *m_instance;
 
-				std::map<nimble_uid, size_t> m_map;
+				size_t m_size;
 
-				nimble_uid m_next;
+				std::vector<nimble_uid_slot> m_slot;
 
-				std::set<nimble_uid> m_surplus;
+				nimble_stats m_stats;
 
 			private:
 
-				std::recursive_mutex m_lock;
+				nimble_lock_policy m_lock;
 
 		} nimble_uid_factory, *nimble_uid_factory_ptr;
 
@@ -179,20 +201,24 @@ namespace NIMBLE {
 					__in const _nimble_uid_class &other
 					);
 
+				_nimble_uid_class(
+					__in _nimble_uid_class &&other
+					);
+
 				virtual ~_nimble_uid_class(void);
 
 				_nimble_uid_class &operator=(
 					__in const _nimble_uid_class &other
 					);
 
+				_nimble_uid_class &operator=(
+					__in _nimble_uid_class &&other
+					);
+
 			protected:
 
 				nimble_uid_factory_ptr factory(void);
 
-			private:
-
-				std::recursive_mutex m_lock;
-
 		} nimble_uid_class, *nimble_uid_class_ptr;
 	}
 }
@@ -37,6 +37,7 @@ namespace NIMBLE {
 			NIMBLE_UID_EXCEPTION_INITIALIZED,
 			NIMBLE_UID_EXCEPTION_NOT_FOUND,
 			NIMBLE_UID_EXCEPTION_RESOURCES,
+			NIMBLE_UID_EXCEPTION_STALE,
 			NIMBLE_UID_EXCEPTION_UNINITIALIZED,
 		};
 
@@ -47,6 +48,7 @@ namespace NIMBLE {
 			"Uid component is initialized",
 			"Uid does not exist",
 			"Uid factory is full",
+			"Uid is stale",
 			"Uid component is uninitialized",
 			};
 
@@ -0,0 +1,497 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_VECTOR_H_
+#define NIMBLE_VECTOR_H_
+
+#include <cstring>
+#include <type_traits>
+#include "nimble_vector_type.h"
+
+namespace NIMBLE {
+
+	namespace COMPONENT {
+
+		#define VEC_CAPACITY_MAX (INVALID_TYPE(uint32_t) >> 1)
+
+		template<class T, uint32_t N> class _nimble_small_vector {
+
+			static_assert(std::is_trivial<T>::value, "Small vector requires a trivial type");
+			static_assert(N > 0, "Small vector requires inline capacity");
+
+			public:
+
+				typedef T *iterator;
+
+				typedef const T *const_iterator;
+
+				_nimble_small_vector(void);
+
+				_nimble_small_vector(
+					__in const _nimble_small_vector &other
+					);
+
+				_nimble_small_vector(
+					__in _nimble_small_vector &&other
+					);
+
+				~_nimble_small_vector(void);
+
+				_nimble_small_vector &operator=(
+					__in const _nimble_small_vector &other
+					);
+
+				_nimble_small_vector &operator=(
+					__in _nimble_small_vector &&other
+					);
+
+				void assign(
+					__in uint32_t count,
+					__in const T &value
+					);
+
+				T &at(
+					__in uint32_t position
+					);
+
+				const T &at(
+					__in uint32_t position
+					) const;
+
+				T &back(void);
+
+				iterator begin(void);
+
+				const_iterator begin(void) const;
+
+				uint32_t capacity(void) const;
+
+				void clear(void);
+
+				bool empty(void) const;
+
+				iterator end(void);
+
+				const_iterator end(void) const;
+
+				T &front(void);
+
+				bool is_inline(void) const;
+
+				void push_back(
+					__in const T &value
+					);
+
+				void reserve(
+					__in uint32_t capacity
+					);
+
+				uint32_t size(void) const;
+
+			protected:
+
+				T *data(void);
+
+				const T *data(void) const;
+
+				void release(void);
+
+				union {
+					T *m_heap;
+					T m_inline[N];
+				};
+
+				uint32_t m_capacity;
+
+				uint32_t m_size;
+
+		};
+
+		template<class T, uint32_t N> using nimble_small_vector = _nimble_small_vector<T, N>;
+
+		template<class T, uint32_t N> 
+		_nimble_small_vector<T, N>::_nimble_small_vector(void) :
+			m_capacity(N),
+			m_size(0)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> 
+		_nimble_small_vector<T, N>::_nimble_small_vector(
+			__in const _nimble_small_vector &other
+			) :
+				m_capacity(N),
+				m_size(0)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			reserve(other.m_size);
+			std::memcpy(data(), other.data(), other.m_size * sizeof(T));
+			m_size = other.m_size;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> 
+		_nimble_small_vector<T, N>::_nimble_small_vector(
+			__in _nimble_small_vector &&other
+			) :
+				m_capacity(other.m_capacity),
+				m_size(other.m_size)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(other.is_inline()) {
+				std::memcpy(m_inline, other.m_inline, other.m_size * sizeof(T));
+			} else {
+				m_heap = other.m_heap;
+				other.m_capacity = N;
+			}
+
+			other.m_size = 0;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> 
+		_nimble_small_vector<T, N>::~_nimble_small_vector(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			release();
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> _nimble_small_vector<T, N> &
+		_nimble_small_vector<T, N>::operator=(
+			__in const _nimble_small_vector &other
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+				m_size = 0;
+				reserve(other.m_size);
+				std::memcpy(data(), other.data(), other.m_size * sizeof(T));
+				m_size = other.m_size;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
+		template<class T, uint32_t N> _nimble_small_vector<T, N> &
+		_nimble_small_vector<T, N>::operator=(
+			__in _nimble_small_vector &&other
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+				release();
+				m_capacity = other.m_capacity;
+				m_size = other.m_size;
+
+				if(other.is_inline()) {
+					std::memcpy(m_inline, other.m_inline, other.m_size * sizeof(T));
+				} else {
+					m_heap = other.m_heap;
+					other.m_capacity = N;
+				}
+
+				other.m_size = 0;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
+		template<class T, uint32_t N> void 
+		_nimble_small_vector<T, N>::assign(
+			__in uint32_t count,
+			__in const T &value
+			)
+		{
+			uint32_t iter;
+			T *entry = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			m_size = 0;
+			reserve(count);
+
+			for(entry = data(), iter = 0; iter < count; ++iter) {
+				entry[iter] = value;
+			}
+
+			m_size = count;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> T &
+		_nimble_small_vector<T, N>::at(
+			__in uint32_t position
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(position >= m_size) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %u", 
+					NIMBLE_VECTOR_EXCEPTION_STRING(NIMBLE_VECTOR_EXCEPTION_OUT_OF_RANGE), position);
+				THROW_NIMBLE_VECTOR_EXCEPTION_MESSAGE(NIMBLE_VECTOR_EXCEPTION_OUT_OF_RANGE,
+					"%u", position);
+			}
+
+			T &result = data()[position];
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &result);
+			return result;
+		}
+
+		template<class T, uint32_t N> const T &
+		_nimble_small_vector<T, N>::at(
+			__in uint32_t position
+			) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(position >= m_size) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %u", 
+					NIMBLE_VECTOR_EXCEPTION_STRING(NIMBLE_VECTOR_EXCEPTION_OUT_OF_RANGE), position);
+				THROW_NIMBLE_VECTOR_EXCEPTION_MESSAGE(NIMBLE_VECTOR_EXCEPTION_OUT_OF_RANGE,
+					"%u", position);
+			}
+
+			const T &result = data()[position];
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &result);
+			return result;
+		}
+
+		template<class T, uint32_t N> T &
+		_nimble_small_vector<T, N>::back(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!m_size) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_VECTOR_EXCEPTION_STRING(NIMBLE_VECTOR_EXCEPTION_EMPTY));
+				THROW_NIMBLE_VECTOR_EXCEPTION(NIMBLE_VECTOR_EXCEPTION_EMPTY);
+			}
+
+			T &result = data()[m_size - 1];
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &result);
+			return result;
+		}
+
+		template<class T, uint32_t N> typename _nimble_small_vector<T, N>::iterator 
+		_nimble_small_vector<T, N>::begin(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", data());
+			return data();
+		}
+
+		template<class T, uint32_t N> typename _nimble_small_vector<T, N>::const_iterator 
+		_nimble_small_vector<T, N>::begin(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", data());
+			return data();
+		}
+
+		template<class T, uint32_t N> uint32_t 
+		_nimble_small_vector<T, N>::capacity(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %u", m_capacity);
+			return m_capacity;
+		}
+
+		template<class T, uint32_t N> void 
+		_nimble_small_vector<T, N>::clear(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			m_size = 0;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> T *
+		_nimble_small_vector<T, N>::data(void)
+		{
+			T *result = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = (is_inline() ? m_inline : m_heap);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T, uint32_t N> const T *
+		_nimble_small_vector<T, N>::data(void) const
+		{
+			const T *result = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = (is_inline() ? m_inline : m_heap);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			return result;
+		}
+
+		template<class T, uint32_t N> bool 
+		_nimble_small_vector<T, N>::empty(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", !m_size);
+			return !m_size;
+		}
+
+		template<class T, uint32_t N> typename _nimble_small_vector<T, N>::iterator 
+		_nimble_small_vector<T, N>::end(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", data() + m_size);
+			return (data() + m_size);
+		}
+
+		template<class T, uint32_t N> typename _nimble_small_vector<T, N>::const_iterator 
+		_nimble_small_vector<T, N>::end(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", data() + m_size);
+			return (data() + m_size);
+		}
+
+		template<class T, uint32_t N> T &
+		_nimble_small_vector<T, N>::front(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!m_size) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", 
+					NIMBLE_VECTOR_EXCEPTION_STRING(NIMBLE_VECTOR_EXCEPTION_EMPTY));
+				THROW_NIMBLE_VECTOR_EXCEPTION(NIMBLE_VECTOR_EXCEPTION_EMPTY);
+			}
+
+			T &result = data()[0];
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &result);
+			return result;
+		}
+
+		template<class T, uint32_t N> bool 
+		_nimble_small_vector<T, N>::is_inline(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = (m_capacity == N);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
+		}
+
+		template<class T, uint32_t N> void 
+		_nimble_small_vector<T, N>::push_back(
+			__in const T &value
+			)
+		{
+			T copy = value;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(m_size == m_capacity) {
+				reserve(m_capacity << 1);
+			}
+
+			data()[m_size++] = copy;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> void 
+		_nimble_small_vector<T, N>::release(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!is_inline()) {
+				delete [] m_heap;
+				m_capacity = N;
+			}
+
+			m_size = 0;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> void 
+		_nimble_small_vector<T, N>::reserve(
+			__in uint32_t capacity
+			)
+		{
+			T *entry = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(capacity > m_capacity) {
+
+				if(capacity > VEC_CAPACITY_MAX) {
+					TRACE_MESSAGE(TRACE_ERROR, "%s, cap. %u", 
+						NIMBLE_VECTOR_EXCEPTION_STRING(NIMBLE_VECTOR_EXCEPTION_RESOURCES), capacity);
+					THROW_NIMBLE_VECTOR_EXCEPTION_MESSAGE(NIMBLE_VECTOR_EXCEPTION_RESOURCES,
+						"%u", capacity);
+				}
+
+				entry = new T[capacity];
+				std::memcpy(entry, data(), m_size * sizeof(T));
+
+				if(!is_inline()) {
+					delete [] m_heap;
+				}
+
+				m_heap = entry;
+				m_capacity = capacity;
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		template<class T, uint32_t N> uint32_t 
+		_nimble_small_vector<T, N>::size(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %u", m_size);
+			return m_size;
+		}
+	}
+}
+
+#endif // NIMBLE_VECTOR_H_
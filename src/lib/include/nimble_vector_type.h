@@ -0,0 +1,56 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NIMBLE_VECTOR_TYPE_H_
+#define NIMBLE_VECTOR_TYPE_H_
+
+namespace NIMBLE {
+
+	namespace COMPONENT {
+
+		#define NIMBLE_VECTOR_HEADER "Vector"
+
+		enum {
+			NIMBLE_VECTOR_EXCEPTION_EMPTY = 0,
+			NIMBLE_VECTOR_EXCEPTION_OUT_OF_RANGE,
+			NIMBLE_VECTOR_EXCEPTION_RESOURCES,
+		};
+
+		#define NIMBLE_VECTOR_EXCEPTION_MAX NIMBLE_VECTOR_EXCEPTION_RESOURCES
+
+		static const std::string NIMBLE_VECTOR_EXCEPTION_STR[] = {
+			"Vector is empty",
+			"Vector position out of range",
+			"Vector capacity exhausted",
+			};
+
+		#define NIMBLE_VECTOR_EXCEPTION_STRING(_TYPE_) \
+			((_TYPE_) > NIMBLE_VECTOR_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : \
+			CHK_STR(NIMBLE_VECTOR_EXCEPTION_STR[_TYPE_]))
+
+		#define THROW_NIMBLE_VECTOR_EXCEPTION(_EXCEPT_) \
+			THROW_EXCEPTION(NIMBLE_VECTOR_HEADER, \
+			NIMBLE_VECTOR_EXCEPTION_STRING(_EXCEPT_))
+		#define THROW_NIMBLE_VECTOR_EXCEPTION_MESSAGE(_EXCEPT_, _FORMAT_, ...) \
+			THROW_EXCEPTION_MESSAGE(NIMBLE_VECTOR_HEADER, \
+			NIMBLE_VECTOR_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+	}
+}
+
+#endif // NIMBLE_VECTOR_TYPE_H_
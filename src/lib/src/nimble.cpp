@@ -19,6 +19,8 @@
 
 #include <csignal>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include "../include/nimble.h"
 #include "../include/nimble_type.h"
 
@@ -30,12 +32,15 @@ namespace NIMBLE {
 	#define ENV_HOME "HOME"
 	#define ENV_HOST "HOST"
 	#define ENV_PWD "PWD"
+	#define ENV_STATS "NIMBLE_STATS"
 	#define ENV_UNKNOWN "unknown"
 	#define ENV_USER "USER"
 
 	nimble_ptr nimble::m_instance = NULL;
 
 	_nimble::_nimble(void) :
+		m_environment_scope(&m_environment_map),
+		m_environment_share(NULL),
 		m_factory_command(nimble_command_factory::acquire()),
 		m_factory_node(nimble_node_factory::acquire()),
 		m_factory_token(nimble_token_factory::acquire()),
@@ -149,6 +154,20 @@ namespace NIMBLE {
 		std::exit(sig);
 	}
 
+	void 
+	_nimble::_signal_trace(
+		__in int sig
+		)
+	{
+
+		if(sig == SIGUSR1) {
+			nimble_trace::set_level((nimble_lvl_t) ((nimble_trace::level() + 1) 
+				% (nimble_trace::level_max() + 1)));
+		} else {
+			nimble_trace::set_level(TRACE_NONE);
+		}
+	}
+
 	nimble_ptr 
 	_nimble::acquire(void)
 	{
@@ -364,6 +383,7 @@ namespace NIMBLE {
 		)
 	{
 		bool result;
+		std::string value;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
 		SERIALIZE_CALL_RECUR(m_lock);
@@ -374,12 +394,33 @@ namespace NIMBLE {
 			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
 		}
 
-		result = (m_environment_map.find(field) != m_environment_map.end());
+		result = m_environment_scope.find(field, nimble_environment::hash(field.c_str(), 
+			field.size()), value);
 
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
 		return result;
 	}
 
+	char **
+	_nimble::environment_export(void)
+	{
+		char **result = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		result = m_environment_scope.envp();
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p", result);
+		return result;
+	}
+
 	nimble_environment_map::iterator 
 	_nimble::environment_find(
 		__in const std::string &field
@@ -398,7 +439,7 @@ namespace NIMBLE {
 
 		result = m_environment_map.find(field);
 
-		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p", result);
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result - m_environment_map.begin());
 		return result;
 	}
 
@@ -422,14 +463,125 @@ namespace NIMBLE {
 		return result;
 	}
 
+	bool 
+	_nimble::environment_lookup(
+		__in const std::string &field,
+		__in uint32_t hash,
+		__out std::string &value
+		)
+	{
+		bool result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		if(hash == ENV_HASH_INVALID) {
+			hash = nimble_environment::hash(field.c_str(), field.size());
+		}
+
+		result = m_environment_scope.find(field, hash, value);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+		return result;
+	}
+
+	void 
+	_nimble::environment_remove(
+		__in const std::string &field
+		)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		m_environment_scope.remove(field, nimble_environment::hash(field.c_str(), 
+			field.size()));
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	size_t 
+	_nimble::environment_scope_depth(void)
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		result = m_environment_scope.depth();
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble::environment_scope_pop(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		m_environment_scope.pop();
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble::environment_scope_push(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		m_environment_scope.push();
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void *
+	_nimble::environment_share(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p", m_environment_share);
+		return m_environment_share;
+	}
+
 	void 
 	_nimble::environment_set(
 		__in const std::string &field,
-		__in const std::string &value
+		__in const std::string &value,
+		__in_opt uint32_t hash
 		)
 	{
-		nimble_environment_map::iterator iter;
-
 		TRACE_ENTRY(TRACE_VERBOSE);
 		SERIALIZE_CALL_RECUR(m_lock);
 
@@ -439,13 +591,12 @@ namespace NIMBLE {
 			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
 		}
 
-		iter = m_environment_map.find(field);
-		if(iter == m_environment_map.end()) {
-			m_environment_map.insert(std::pair<std::string, std::string>(field, value));
-		} else {
-			iter->second = value;
+		if(hash == ENV_HASH_INVALID) {
+			hash = nimble_environment::hash(field.c_str(), field.size());
 		}
 
+		m_environment_scope.set(field, value, hash);
+
 		TRACE_EXIT(TRACE_VERBOSE);
 	}
 
@@ -486,12 +637,14 @@ namespace NIMBLE {
 						TRACE_MESSAGE(TRACE_INFORMATION, 
 							"Changing environment pair <%s, %s> -> <%s, %s>", 
 							entry, CHK_STR(iter->second), entry, value);
-						iter->second = value;
+						m_environment_map.set(entry, value, nimble_environment::hash(entry, 
+							std::strlen(entry)));
 					}
 				}
 			}
 		} else {
 			m_environment_map.clear();
+			m_environment_scope.clear();
 
 			for(; environment != NULL; ++environment) {
 
@@ -525,8 +678,10 @@ namespace NIMBLE {
 			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_INITIALIZED);
 		}
 
+		m_environment_share = nimble_environment::allocate();
 		m_initialized = true;
 		m_environment_map.clear();
+		m_environment_scope.clear();
 		m_factory_uid->initialize();
 		m_factory_token->initialize();
 		m_factory_node->initialize();
@@ -575,6 +730,8 @@ namespace NIMBLE {
 		std::signal(SIGILL, nimble::_signal_illegal);
 		std::signal(SIGSEGV, nimble::_signal_invalid);
 		std::signal(SIGTERM, nimble::_signal_terminate);
+		std::signal(SIGUSR1, nimble::_signal_trace);
+		std::signal(SIGUSR2, nimble::_signal_trace);
 
 		TRACE_EXIT(TRACE_VERBOSE);
 	}
@@ -591,7 +748,6 @@ namespace NIMBLE {
 		std::string home, host, input, pwd, user;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 
 		if(!m_initialized) {
 			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
@@ -607,6 +763,7 @@ namespace NIMBLE {
 			for(;;) {
 				result = 0;
 				m_result = 0;
+				m_factory_command->poll();
 				display_prompt(home, host, pwd, user, true, update);
 
 				if(update) {
@@ -614,6 +771,7 @@ namespace NIMBLE {
 				}
 
 				std::getline(std::cin, input);
+				PROBE1(line__read, input.size());
 				TRACE_MESSAGE(TRACE_INFORMATION, "Command: \'%s\'[%lu]", 
 					CHK_STR(input), input.size());
 
@@ -647,6 +805,68 @@ namespace NIMBLE {
 		return result;
 	}
 
+	std::string 
+	_nimble::stats_as_string(
+		__in_opt bool json
+		)
+	{
+		std::stringstream result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		if(!m_initialized) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_EXCEPTION_STRING(
+				NIMBLE_EXCEPTION_UNINITIALIZED));
+			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
+		}
+
+		if(json) {
+			result << "{\"pid\":" << getpid()
+				<< "," << nimble_stats::as_string("uid", m_factory_uid->stats(), true)
+				<< "," << nimble_stats::as_string("token", m_factory_token->stats(), true)
+				<< "," << nimble_stats::as_string("node", m_factory_node->stats(), true)
+				<< "," << nimble_stats::as_string("command", m_factory_command->stats(), true)
+				<< "," << nimble_stats::as_string("lexer", nimble_lexer::token_stats(), true)
+				<< "," << nimble_stats::as_string("parser", nimble_parser::statement_stats(), 
+					true) << "}";
+		} else {
+			result << nimble_stats::header()
+				<< std::endl << nimble_stats::as_string("uid", m_factory_uid->stats())
+				<< std::endl << nimble_stats::as_string("token", m_factory_token->stats())
+				<< std::endl << nimble_stats::as_string("node", m_factory_node->stats())
+				<< std::endl << nimble_stats::as_string("command", m_factory_command->stats())
+				<< std::endl << nimble_stats::as_string("lexer", nimble_lexer::token_stats())
+				<< std::endl << nimble_stats::as_string("parser", 
+					nimble_parser::statement_stats());
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
+		return CHK_STR(result.str());
+	}
+
+	void 
+	_nimble::stats_dump(void)
+	{
+		const char *path = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		SERIALIZE_CALL_RECUR(m_lock);
+
+		path = std::getenv(ENV_STATS);
+		if(path && *path) {
+
+			std::ofstream file(path, std::ios::out | std::ios::app);
+			if(file) {
+				file << stats_as_string(true) << std::endl;
+			} else {
+				TRACE_MESSAGE(TRACE_WARNING, "Failed to open stats dump: %s", path);
+			}
+		}
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
 	std::string 
 	_nimble::to_string(
 		__in_opt bool verbose
@@ -684,12 +904,20 @@ namespace NIMBLE {
 			THROW_NIMBLE_EXCEPTION(NIMBLE_EXCEPTION_UNINITIALIZED);
 		}
 
+		stats_dump();
 		m_result = 0;
 		m_factory_command->uninitialize();
 		m_factory_node->uninitialize();
 		m_factory_token->uninitialize();
 		m_factory_uid->uninitialize();
 		m_environment_map.clear();
+		m_environment_scope.clear();
+
+		if(m_environment_share) {
+			nimble_environment::release(m_environment_share);
+			m_environment_share = NULL;
+		}
+
 		m_initialized = false;
 
 		TRACE_EXIT(TRACE_VERBOSE);
@@ -17,11 +17,18 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <errno.h>
-#include <sys/mman.h>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#include <vector>
 #include "../include/nimble.h"
 #include "../include/nimble_command_type.h"
 
@@ -29,14 +36,77 @@ namespace NIMBLE {
 
 	namespace COMPONENT {
 
-		#define MAP_INVALID INVALID_TYPE(int)
+		#define JOB_NULL "/dev/null"
+		#define JOB_STATE_WIDTH 12
+		#define JOB_WHITESPACE " \t\r"
+		#define PAR_BUF_LEN 4096
+		#define PAR_FLAG_FILE "-f"
+		#define PAR_FLAG_VERBOSE "-v"
+		#define PAR_FLAG_WORKER "-j"
+		#define STATS_FLAG_JSON "-j"
+		#define TIME_LOG_ENV "NIMBLE_TIME_LOG"
+		#define TIME_LOG_JSON_EXT ".jsonl"
+		#define TIME_NSEC_PER_SEC 1000000000.0
+		#define TIME_NSEC_PER_USEC 1000
+		#define TIME_USEC_PER_SEC 1000000
+		#define TRACE_FLAG_PROFILE "profile"
+		#define TRACE_PROFILE_OFF "off"
+		#define TRACE_PROFILE_ON "on"
+		#define TRACE_PROFILE_RESET "reset"
+
+		static const std::string TIME_PHASE_STR[] = {
+			"lex", "parse", "evaluate", "fork", "exec", "wait", "total",
+			};
+
+		#define TIME_PHASE_STRING(_TYPE_) \
+			((_TYPE_) > TIME_PHASE_MAX ? UNKNOWN : \
+			CHK_STR(TIME_PHASE_STR[_TYPE_]))
+
+		struct _nimble_cmd_par_ctx {
+
+			_nimble_cmd_par_ctx(
+				__in size_t jobs,
+				__in size_t workers
+				) :
+					command(jobs, NULL),
+					complete(jobs, false),
+					output(jobs),
+					queue(workers),
+					queue_lock(workers),
+					status(jobs, 0)
+			{
+				TRACE_ENTRY(TRACE_VERBOSE);
+				TRACE_EXIT(TRACE_VERBOSE);
+			}
+
+			std::vector<nimble_command_ptr> command;
+
+			std::vector<bool> complete;
+
+			std::mutex lock;
+
+			std::vector<std::string> output;
+
+			std::vector<std::deque<size_t>> queue;
+
+			std::vector<std::mutex> queue_lock;
+
+			std::condition_variable signal;
+
+			std::vector<int> status;
+		};
 
 		_nimble_command::_nimble_command(void) :
 			m_active(false),
+			m_background(false),
 			m_complete(NULL),
 			m_par_environment(NULL),
 			m_pid(PID_INVALID),
-			m_result(0)
+			m_probe_begin(0),
+			m_result(0),
+			m_share(NULL),
+			m_stopped(false),
+			m_time()
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -47,12 +117,45 @@ namespace NIMBLE {
 			) :
 				nimble_uid_class(other),
 				m_active(other.m_active),
+				m_background(other.m_background),
+				m_complete(other.m_complete),
+				m_par_environment(other.m_par_environment),
+				m_pid(other.m_pid),
+				m_probe_begin(other.m_probe_begin),
+				m_result(other.m_result),
+				m_share(other.m_share),
+				m_stopped(other.m_stopped),
+				m_text(other.m_text),
+				m_time(other.m_time)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		_nimble_command::_nimble_command(
+			__in _nimble_command &&other
+			) :
+				nimble_uid_class(std::move(other)),
+				m_active(other.m_active),
+				m_background(other.m_background),
 				m_complete(other.m_complete),
 				m_par_environment(other.m_par_environment),
 				m_pid(other.m_pid),
-				m_result(other.m_result)
+				m_probe_begin(other.m_probe_begin),
+				m_result(other.m_result),
+				m_share(other.m_share),
+				m_stopped(other.m_stopped),
+				m_text(std::move(other.m_text)),
+				m_time(other.m_time)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
+
+			other.m_active = false;
+			other.m_complete = NULL;
+			other.m_par_environment = NULL;
+			other.m_pid = PID_INVALID;
+			other.m_share = NULL;
+
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
@@ -73,21 +176,80 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				nimble_uid_class::operator=(other);
 				m_active = other.m_active;
+				m_background = other.m_background;
+				m_complete = other.m_complete;
+				m_par_environment = other.m_par_environment;
+				m_pid = other.m_pid;
+				m_probe_begin = other.m_probe_begin;
+				m_result = other.m_result;
+				m_share = other.m_share;
+				m_stopped = other.m_stopped;
+				m_text = other.m_text;
+				m_time = other.m_time;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
+		_nimble_command &
+		_nimble_command::operator=(
+			__in _nimble_command &&other
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+				nimble_uid_class::operator=(std::move(other));
+				m_active = other.m_active;
+				m_background = other.m_background;
 				m_complete = other.m_complete;
 				m_par_environment = other.m_par_environment;
 				m_pid = other.m_pid;
+				m_probe_begin = other.m_probe_begin;
 				m_result = other.m_result;
+				m_share = other.m_share;
+				m_stopped = other.m_stopped;
+				m_text = std::move(other.m_text);
+				m_time = other.m_time;
+				other.m_active = false;
+				other.m_complete = NULL;
+				other.m_par_environment = NULL;
+				other.m_pid = PID_INVALID;
+				other.m_share = NULL;
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
 			return *this;
 		}
 
+		void 
+		_nimble_command::_terminal_set(
+			__in pid_t group
+			)
+		{
+			sigset_t mask, previous;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			sigemptyset(&mask);
+			sigaddset(&mask, SIGTTOU);
+			sigprocmask(SIG_BLOCK, &mask, &previous);
+
+			if(tcsetpgrp(STDIN_FILENO, group) == INVALID_TYPE(int)) {
+				TRACE_MESSAGE(TRACE_WARNING, "Failed to set terminal group, grp. %x, err. %x", 
+					group, errno);
+			}
+
+			sigprocmask(SIG_SETMASK, &previous, NULL);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
 		std::string 
 		_nimble_command::as_string(
 			__in const _nimble_command &command,
@@ -102,7 +264,17 @@ namespace NIMBLE {
 				result << nimble_uid::as_string(command.m_uid) << " ";
 			}
 
-			result << "[" << (command.m_active ? "ACT" : "INACT") << "]";
+			result << "[" << (command.m_active ? "ACT" : "INACT");
+
+			if(command.m_background) {
+				result << ", BG";
+			}
+
+			if(command.m_stopped) {
+				result << ", STOP";
+			}
+
+			result << "]";
 
 			if(command.m_active) {
 				result << ", comp. " << VAL_AS_HEX(_nimble_cmd_fact_cb, command.m_complete)
@@ -114,39 +286,140 @@ namespace NIMBLE {
 			return CHK_STR(result.str());
 		}
 
+		bool 
+		_nimble_command::foreground(void)
+		{
+			bool result = false;
+			pid_t group = PID_INVALID;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!m_active) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE),
+					CHK_STR(nimble_uid::as_string(m_uid)));
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE,
+					"%s", CHK_STR(nimble_uid::as_string(m_uid)));
+			}
+
+			if(m_background && isatty(STDIN_FILENO) 
+					&& (tcgetpgrp(STDIN_FILENO) == getpgrp())) {
+				group = getpgrp();
+				_terminal_set(m_pid);
+			}
+
+			try {
+				resume();
+				result = wait();
+			} catch(...) {
+
+				if(group != PID_INVALID) {
+					_terminal_set(group);
+				}
+
+				throw;
+			}
+
+			if(group != PID_INVALID) {
+				_terminal_set(group);
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
+		}
+
 		bool 
 		_nimble_command::is_active(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_active);
 			return m_active;
 		}
 
+		bool 
+		_nimble_command::is_background(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_background);
+			return m_background;
+		}
+
+		bool 
+		_nimble_command::is_stopped(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_stopped);
+			return m_stopped;
+		}
+
+		pid_t 
+		_nimble_command::pid(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %x", m_pid);
+			return m_pid;
+		}
+
 		int 
 		_nimble_command::result(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_result);
 			return m_result;
 		}
 
+		void 
+		_nimble_command::resume(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!m_active) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE),
+					CHK_STR(nimble_uid::as_string(m_uid)));
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE,
+					"%s", CHK_STR(nimble_uid::as_string(m_uid)));
+			}
+
+			if(kill(m_background ? -m_pid : m_pid, SIGCONT) == INVALID_TYPE(int)) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pid. %x, err. %x", 
+					NIMBLE_COMMAND_EXCEPTION_STRING(NIMBLE_COMMAND_EXCEPTION_PID_KILL),
+					CHK_STR(nimble_uid::as_string(m_uid)), m_pid, errno);
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_PID_KILL,
+					"%s, pid. %x, err. %x", CHK_STR(nimble_uid::as_string(m_uid)), 
+					m_pid, errno);
+			}
+
+			m_stopped = false;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
 		void 
 		_nimble_command::run(
 			__in const std::string &command,
 			__in _nimble_cmd_fact_cb complete,
-			__out bool &update
+			__out bool &update,
+			__in_opt bool background,
+			__in_opt int output,
+			__in_opt uint8_t time
 			)
 		{
+			int fd;
+			sigset_t mask;
+			struct rusage usage;
+			uint64_t begin = 0;
 			uint16_t iter = 0;
+			bool control = false;
 			char *share = NULL;
-			nimble_executor exe;
+			uint16_t count = 0;
+			uint32_t field_length, value_length;
+			const char *field_data = NULL, *value_data = NULL;
 			nimble_ptr inst = NULL;
 			std::string field, value;
+			_nimble_cmd_fact_cb callback = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(m_active) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
@@ -162,22 +435,36 @@ namespace NIMBLE {
 					"%s", CHK_STR(nimble_uid::as_string(m_uid)));
 			}
 
-			share = (char *) mmap(NULL, ENV_MEM_LEN, PROT_READ | PROT_WRITE, 
-				MAP_ANON | MAP_SHARED, -1, 0);
-
-			if(!share || (share == MAP_FAILED)) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
-					NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SHARE), errno);
-				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SHARE,
-					"err. 0x%x", errno);
+			if(background) {
+				share = (char *) nimble_environment::allocate();
+			} else {
+				share = (char *) nimble::acquire()->environment_share();
 			}
 
-			nimble_environment::initialize(share, ENV_MEM_LEN);
+			nimble_environment::reset(share);
 			m_active = true;
-			m_complete = complete;
+			m_background = background;
+			m_complete = (background ? NULL : complete);
 			m_par_environment = nimble::acquire()->environment_instance();
 			m_pid = PID_INVALID;
 			m_result = 0;
+			m_share = share;
+			m_stopped = false;
+			m_text = command;
+			memset(&m_time, 0, sizeof(m_time));
+			m_time.flag = time;
+
+			if(m_time.flag) {
+				nimble_environment::flag_set(share, ENV_FLAG_TIME);
+			}
+
+			if(background) {
+				control = (isatty(STDIN_FILENO) && (tcgetpgrp(STDIN_FILENO) == getpgrp()));
+			}
+
+			begin = ((m_time.flag || PROBE_ACTIVE(fork)) ? nimble_probe::now() : 0);
+			m_probe_begin = PROBE_TIME(wait__done);
+			m_time.begin = begin;
 
 			m_pid = fork();
 			if(m_pid == PID_INVALID) {
@@ -187,10 +474,44 @@ namespace NIMBLE {
 					"%s", CHK_STR(nimble_uid::as_string(m_uid)));
 			}
 
+			if(m_pid) {
+
+				if(background) {
+					setpgid(m_pid, m_pid);
+				}
+
+				if(m_time.flag) {
+					m_time.phase[TIME_PHASE_FORK] = (nimble_probe::now() - begin);
+				}
+
+				PROBE2(fork, m_pid, PROBE_ELAPSED(fork, begin));
+			}
+
 			if(!m_pid) {
+				sigemptyset(&mask);
+				sigaddset(&mask, SIGCHLD);
+				sigprocmask(SIG_UNBLOCK, &mask, NULL);
+
+				if(background) {
+					setpgid(0, 0);
+
+					if(!control) {
+
+						fd = open(JOB_NULL, O_RDONLY);
+						if(fd != FD_INVALID) {
+							dup2(fd, STDIN_FILENO);
+							close(fd);
+						}
+					}
+				}
+
+				if(output != FD_INVALID) {
+					dup2(output, STDOUT_FILENO);
+					close(output);
+				}
 
 				try {
-					exe.set(command);
+					nimble_executor exe(command);
 					m_result = exe.evaluate(share);
 				} catch(nimble_exception &exc) {
 					TRACE_MESSAGE(TRACE_ERROR, "%s", CHK_STR(exc.to_string(true)));
@@ -202,17 +523,12 @@ namespace NIMBLE {
 					m_result = INVALID_TYPE(int);
 				}
 
-				if(munmap(share, ENV_MEM_LEN) == MAP_INVALID) {
-					TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
-						NIMBLE_COMMAND_EXCEPTION_UNALLOCATED_SHARE), errno);
-					THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_UNALLOCATED_SHARE,
-						"err. 0x%x", errno);
-				}
-
+				nimble::acquire()->stats_dump();
+				TRACE_STOP();
 				_exit(m_result);
-			} else {
+			} else if(!background) {
 
-				if(waitpid(m_pid, &m_result, 0) == PID_INVALID) {
+				if(wait4(m_pid, &m_result, 0, &usage) == PID_INVALID) {
 					TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pid. %x", NIMBLE_COMMAND_EXCEPTION_STRING(
 						NIMBLE_COMMAND_EXCEPTION_PID_WAIT), CHK_STR(nimble_uid::as_string(m_uid)), 
 						m_pid);
@@ -220,36 +536,89 @@ namespace NIMBLE {
 						"%s, pid. %x", CHK_STR(nimble_uid::as_string(m_uid)), m_pid);
 				}
 
+				PROBE3(wait__done, m_pid, m_result, PROBE_ELAPSED(wait__done, m_probe_begin));
+				m_time.usage = usage;
+				time_complete();
 				m_active = false;
 				m_pid = PID_INVALID;
-			}
+				inst = nimble::acquire();
 
-			if(m_complete) {
-				m_complete(*this);
+				if(nimble_environment::is_flag_set(share, ENV_FLAG_EXIT)) {
+					exit(0);
+				}
+
+				count = nimble_environment::count(share);
+
+				for(; iter < count; ++iter) {
+
+					if(nimble_environment::at(share, iter, field_data, field_length, value_data, 
+							value_length) == ENV_ACTION_REMOVE) {
+						inst->environment_remove(field.assign(field_data, field_length));
+					} else {
+						inst->environment_set(field.assign(field_data, field_length), 
+							value.assign(value_data, value_length));
+					}
+				}
+
+				m_par_environment = NULL;
+				m_share = NULL;
+				callback = m_complete;
 				m_complete = NULL;
+
+				if(callback) {
+					callback(*this);
+				}
 			}
 
-			inst = nimble::acquire();
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
 
-			if(nimble_environment::is_flag_set(share, ENV_FLAG_EXIT)) {
-				exit(0);
-			}
+		bool 
+		_nimble_command::status(
+			__in int value,
+			__in_opt const struct rusage *usage
+			)
+		{
+			bool result = false;
 
-			for(; iter < nimble_environment::count(share); ++iter) {
-				nimble_environment::at(share, iter, field, value);
-				inst->environment_set(field, value);
-			}
+			TRACE_ENTRY(TRACE_VERBOSE);
 
-			if(munmap(share, ENV_MEM_LEN) == MAP_INVALID) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
-					NIMBLE_COMMAND_EXCEPTION_UNALLOCATED_SHARE), errno);
-				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_UNALLOCATED_SHARE,
-					"err. 0x%x", errno);
+			if(!m_active) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE),
+					CHK_STR(nimble_uid::as_string(m_uid)));
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE,
+					"%s", CHK_STR(nimble_uid::as_string(m_uid)));
 			}
 
-			m_par_environment = NULL;
+			if(WIFSTOPPED(value)) {
+				m_stopped = true;
+			} else if(WIFCONTINUED(value)) {
+				m_stopped = false;
+			} else if(WIFEXITED(value) || WIFSIGNALED(value)) {
+				PROBE3(wait__done, m_pid, value, PROBE_ELAPSED(wait__done, m_probe_begin));
 
-			TRACE_EXIT(TRACE_VERBOSE);
+				if(usage) {
+					m_time.usage = *usage;
+				}
+
+				time_complete();
+				m_active = false;
+				m_par_environment = NULL;
+				m_pid = PID_INVALID;
+				m_result = value;
+				m_stopped = false;
+
+				if(m_background && m_share) {
+					nimble_environment::release(m_share);
+					m_share = NULL;
+				}
+
+				result = true;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
 		}
 
 		void 
@@ -258,7 +627,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!m_active) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
@@ -270,7 +638,7 @@ namespace NIMBLE {
 
 			if(m_pid > 0) {
 
-				if(kill(m_pid, sig) == INVALID_TYPE(int)) {
+				if(kill(m_background ? -m_pid : m_pid, sig) == INVALID_TYPE(int)) {
 					TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pid. %x, err. %x", 
 						NIMBLE_COMMAND_EXCEPTION_STRING(NIMBLE_COMMAND_EXCEPTION_PID_KILL),
 						CHK_STR(nimble_uid::as_string(m_uid)), m_pid, errno);
@@ -280,10 +648,16 @@ namespace NIMBLE {
 				}
 			}
 
+			if(m_background && m_share) {
+				nimble_environment::release(m_share);
+			}
+
 			m_active = false;
 			m_pid = PID_INVALID;
 			m_par_environment = NULL;
 			m_result = 0;
+			m_share = NULL;
+			m_stopped = false;
 
 			if(m_complete) {
 				m_complete(*this);
@@ -293,6 +667,189 @@ namespace NIMBLE {
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
+		std::string &
+		_nimble_command::text(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_text));
+			return m_text;
+		}
+
+		nimble_command_time &
+		_nimble_command::time(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+			return m_time;
+		}
+
+		std::string 
+		_nimble_command::time_as_string(
+			__in_opt uint8_t format
+			)
+		{
+			uint8_t iter;
+			std::string text;
+			std::stringstream result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			switch(format) {
+				case TIME_FORMAT_CSV:
+					result << "\"";
+
+					for(std::string::iterator ch = m_text.begin(); ch != m_text.end(); ++ch) {
+
+						if(*ch == '\"') {
+							result << '\"';
+						}
+
+						result << *ch;
+					}
+
+					result << "\"," << m_result;
+
+					for(iter = 0; iter <= TIME_PHASE_MAX; ++iter) {
+						result << "," << m_time.phase[iter];
+					}
+
+					result << "," << ((m_time.usage.ru_utime.tv_sec * TIME_USEC_PER_SEC) 
+							+ m_time.usage.ru_utime.tv_usec)
+						<< "," << ((m_time.usage.ru_stime.tv_sec * TIME_USEC_PER_SEC) 
+							+ m_time.usage.ru_stime.tv_usec)
+						<< "," << m_time.usage.ru_maxrss << "," << m_time.usage.ru_minflt 
+						<< "," << m_time.usage.ru_majflt << "," << m_time.usage.ru_nvcsw 
+						<< "," << m_time.usage.ru_nivcsw;
+					break;
+				case TIME_FORMAT_JSON:
+					result << "{\"command\":\"";
+
+					for(std::string::iterator ch = m_text.begin(); ch != m_text.end(); ++ch) {
+
+						switch(*ch) {
+							case '\"':
+							case '\\':
+								result << '\\' << *ch;
+								break;
+							case '\n':
+								result << "\\n";
+								break;
+							case '\t':
+								result << "\\t";
+								break;
+							default:
+
+								if((uint8_t) *ch < ' ') {
+									result << "\\u" << std::setw(4) << std::setfill('0') 
+										<< std::hex << (int) *ch << std::dec;
+								} else {
+									result << *ch;
+								}
+								break;
+						}
+					}
+
+					result << "\",\"status\":" << m_result << ",\"phase_ns\":{";
+
+					for(iter = 0; iter <= TIME_PHASE_MAX; ++iter) {
+
+						if(iter) {
+							result << ",";
+						}
+
+						result << "\"" << TIME_PHASE_STRING(iter) << "\":" << m_time.phase[iter];
+					}
+
+					result << "},\"user_us\":" << ((m_time.usage.ru_utime.tv_sec * TIME_USEC_PER_SEC) 
+							+ m_time.usage.ru_utime.tv_usec)
+						<< ",\"sys_us\":" << ((m_time.usage.ru_stime.tv_sec * TIME_USEC_PER_SEC) 
+							+ m_time.usage.ru_stime.tv_usec)
+						<< ",\"maxrss_kb\":" << m_time.usage.ru_maxrss 
+						<< ",\"minflt\":" << m_time.usage.ru_minflt 
+						<< ",\"majflt\":" << m_time.usage.ru_majflt 
+						<< ",\"nvcsw\":" << m_time.usage.ru_nvcsw 
+						<< ",\"nivcsw\":" << m_time.usage.ru_nivcsw << "}";
+					break;
+				default:
+					result << std::fixed << std::setprecision(3)
+						<< "real " << (m_time.phase[TIME_PHASE_TOTAL] / TIME_NSEC_PER_SEC) << "s"
+						<< "  user " << (m_time.usage.ru_utime.tv_sec 
+							+ (m_time.usage.ru_utime.tv_usec / (double) TIME_USEC_PER_SEC)) << "s"
+						<< "  sys " << (m_time.usage.ru_stime.tv_sec 
+							+ (m_time.usage.ru_stime.tv_usec / (double) TIME_USEC_PER_SEC)) << "s"
+						<< std::endl;
+
+					for(iter = 0; iter < TIME_PHASE_TOTAL; ++iter) {
+						result << (iter ? "  " : "") << TIME_PHASE_STRING(iter) << " " 
+							<< (m_time.phase[iter] / (double) TIME_NSEC_PER_USEC) << "us";
+					}
+
+					result << std::endl << "maxrss " << m_time.usage.ru_maxrss << "KB"
+						<< "  minflt " << m_time.usage.ru_minflt 
+						<< "  majflt " << m_time.usage.ru_majflt
+						<< "  nvcsw " << m_time.usage.ru_nvcsw 
+						<< "  nivcsw " << m_time.usage.ru_nivcsw;
+					break;
+			}
+
+			text = result.str();
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(text));
+			return CHK_STR(text);
+		}
+
+		void 
+		_nimble_command::time_complete(void)
+		{
+			uint64_t end, exec;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(m_time.flag) {
+				end = nimble_probe::now();
+				m_time.phase[TIME_PHASE_TOTAL] = (end - m_time.begin);
+				m_time.phase[TIME_PHASE_WAIT] = (m_time.phase[TIME_PHASE_TOTAL] 
+					- m_time.phase[TIME_PHASE_FORK]);
+
+				if(m_share) {
+					m_time.phase[TIME_PHASE_LEX] = nimble_environment::timing(m_share, ENV_TIME_LEX);
+					m_time.phase[TIME_PHASE_PARSE] = nimble_environment::timing(m_share, 
+						ENV_TIME_PARSE);
+					m_time.phase[TIME_PHASE_EVALUATE] = nimble_environment::timing(m_share, 
+						ENV_TIME_EVALUATE);
+
+					exec = nimble_environment::timing(m_share, ENV_TIME_EXEC);
+					if(exec && (exec < end)) {
+						m_time.phase[TIME_PHASE_EXEC] = (end - exec);
+					}
+				}
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		std::string 
+		_nimble_command::time_header(void)
+		{
+			uint8_t iter;
+			std::string text;
+			std::stringstream result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result << "command,status";
+
+			for(iter = 0; iter <= TIME_PHASE_MAX; ++iter) {
+				result << "," << TIME_PHASE_STRING(iter) << "_ns";
+			}
+
+			result << ",user_us,sys_us,maxrss_kb,minflt,majflt,nvcsw,nivcsw";
+			text = result.str();
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(text));
+			return CHK_STR(text);
+		}
+
 		std::string 
 		_nimble_command::to_string(
 			__in_opt bool verbose
@@ -301,7 +858,6 @@ namespace NIMBLE {
 			std::string result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = nimble_command::as_string(*this, verbose);
 
@@ -309,11 +865,46 @@ namespace NIMBLE {
 			return CHK_STR(result);
 		}
 
+		bool 
+		_nimble_command::wait(void)
+		{
+			int value = 0;
+			bool result = false;
+			struct rusage usage;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!m_active) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE),
+					CHK_STR(nimble_uid::as_string(m_uid)));
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_NOT_ACTIVE,
+					"%s", CHK_STR(nimble_uid::as_string(m_uid)));
+			}
+
+			if(wait4(m_pid, &value, WUNTRACED, &usage) == PID_INVALID) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pid. %x", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_PID_WAIT), CHK_STR(nimble_uid::as_string(m_uid)), 
+					m_pid);
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_PID_WAIT,
+					"%s, pid. %x", CHK_STR(nimble_uid::as_string(m_uid)), m_pid);
+			}
+
+			result = status(value, &usage);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
+		}
+
 		nimble_command_factory_ptr nimble_command_factory::m_instance = NULL;
 
 		_nimble_command_factory::_nimble_command_factory(void) :
-			m_initialized(false),
-			m_last(UID_INVALID)
+			nimble_object_factory<nimble_command, nimble_storage_pool<nimble_command>, 
+				nimble_lock_policy>(NIMBLE_COMMAND_HEADER),
+			m_job_poll(FD_INVALID),
+			m_job_signal(FD_INVALID),
+			m_last(UID_INVALID),
+			m_time_format(TIME_FORMAT_CSV)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -365,16 +956,140 @@ namespace NIMBLE {
 						&& inst->contains(uid)) {
 					TRACE_MESSAGE(TRACE_INFORMATION, "Removing command: %s", 
 						CHK_STR(nimble_uid::as_string(uid, true)));
-					inst->m_map.erase(inst->find(uid));
+					inst->time_report(inst->at(uid));
+					inst->decrement_reference(uid);
 				}
 			}
 
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
-		nimble_command_factory_ptr 
-		_nimble_command_factory::acquire(void)
-		{
+		std::string 
+		_nimble_command_factory::_result_as_string(
+			__in int result
+			)
+		{
+			std::stringstream stream;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(result == INVALID_TYPE(int)) {
+				stream << "Error";
+			} else if(WIFSIGNALED(result)) {
+				stream << "Killed " << WTERMSIG(result);
+			} else if(WEXITSTATUS(result)) {
+				stream << "Exit " << WEXITSTATUS(result);
+			} else {
+				stream << "Done";
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(stream.str()));
+			return CHK_STR(stream.str());
+		}
+
+		void 
+		_nimble_command_factory::_run_parallel_worker(
+			__in nimble_cmd_par_ctx_ptr context,
+			__in size_t worker
+			)
+		{
+			ssize_t len;
+			bool found, update;
+			int descriptor[2];
+			char buffer[PAR_BUF_LEN];
+			size_t iter, job = 0, position;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			for(;;) {
+				found = false;
+
+				for(iter = 0; iter < context->queue.size(); ++iter) {
+					position = ((worker + iter) % context->queue.size());
+					std::lock_guard<std::mutex> lock(context->queue_lock.at(position));
+
+					std::deque<size_t> &queue = context->queue.at(position);
+					if(!queue.empty()) {
+
+						if(!iter) {
+							job = queue.front();
+							queue.pop_front();
+						} else {
+							job = queue.back();
+							queue.pop_back();
+						}
+
+						found = true;
+						break;
+					}
+				}
+
+				if(!found) {
+					break;
+				}
+
+				nimble_command &command = *context->command.at(job);
+				std::string &output = context->output.at(job);
+
+				try {
+
+					if(pipe2(descriptor, O_CLOEXEC) == INVALID_TYPE(int)) {
+						TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
+							NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SHARE), errno);
+						THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SHARE,
+							"err. 0x%x", errno);
+					}
+
+					try {
+						command.run(command.text(), nimble_command_factory::_remove, update, 
+							true, descriptor[1]);
+					} catch(...) {
+						close(descriptor[0]);
+						close(descriptor[1]);
+						throw;
+					}
+
+					close(descriptor[1]);
+
+					for(;;) {
+
+						len = read(descriptor[0], buffer, PAR_BUF_LEN);
+						if(len > 0) {
+							output.append(buffer, len);
+						} else if(!len || (errno != EINTR)) {
+							break;
+						}
+					}
+
+					close(descriptor[0]);
+
+					while(!command.wait());
+
+					context->status.at(job) = command.result();
+				} catch(nimble_exception &exc) {
+					TRACE_MESSAGE(TRACE_ERROR, "%s", CHK_STR(exc.to_string(true)));
+					output += exc.to_string(true) + "\n";
+					context->status.at(job) = INVALID_TYPE(int);
+				} catch(std::exception &exc) {
+					TRACE_MESSAGE(TRACE_ERROR, "%s", exc.what());
+					output += std::string(exc.what()) + "\n";
+					context->status.at(job) = INVALID_TYPE(int);
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(context->lock);
+					context->complete.at(job) = true;
+				}
+
+				context->signal.notify_all();
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		nimble_command_factory_ptr 
+		_nimble_command_factory::acquire(void)
+		{
 			nimble_command_factory_ptr result = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
@@ -398,12 +1113,14 @@ namespace NIMBLE {
 			return result;
 		}
 
-		bool 
-		_nimble_command_factory::contains(
-			__in const nimble_uid &uid
+		std::map<size_t, std::pair<nimble_uid, pid_t>>::iterator 
+		_nimble_command_factory::find_job(
+			__in const std::string &argument
 			)
 		{
-			bool result;
+			size_t job = JOB_INVALID;
+			std::stringstream stream;
+			std::map<size_t, std::pair<nimble_uid, pid_t>>::iterator result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -414,48 +1131,31 @@ namespace NIMBLE {
 				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = (m_map.find(uid) != m_map.end());
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
-			return result;
-		}
-
-		std::map<nimble_uid, std::pair<nimble_command, 
-				_nimble_cmd_fact_cb>>::iterator 
-		_nimble_command_factory::find(
-			__in const nimble_uid &uid
-			)
-		{
-			std::map<nimble_uid, std::pair<nimble_command, 
-					_nimble_cmd_fact_cb>>::iterator result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
+			if(argument.empty()) {
 
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_COMMAND_EXCEPTION_STRING(
-					NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
+				if(!m_job.empty()) {
+					job = m_job.rbegin()->first;
+				}
+			} else {
+				stream << ((argument.front() == CHAR_JOB) ? argument.substr(1) : argument);
+				stream >> job;
 			}
 
-			result = m_map.find(uid);
-			if(result == m_map.end()) {
+			result = m_job.find(job);
+			if(result == m_job.end()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
-					NIMBLE_COMMAND_EXCEPTION_NOT_FOUND), 
-					CHK_STR(nimble_uid::as_string(uid)));
-				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_NOT_FOUND,
-					"%s", CHK_STR(nimble_uid::as_string(uid)));
+					NIMBLE_COMMAND_EXCEPTION_INVALID_JOB), CHK_STR(argument));
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_INVALID_JOB,
+					"%s", CHK_STR(argument));
 			}
 
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result->first);
 			return result;
 		}
 
 		nimble_uid 
 		_nimble_command_factory::generate(void)
 		{
-			nimble_command command;
-
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -465,12 +1165,8 @@ namespace NIMBLE {
 				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_last = command.uid();
-			TRACE_MESSAGE(TRACE_INFORMATION, "Generating new command: %s", 
-				CHK_STR(m_last.to_string(true)));
-			m_map.insert(std::pair<nimble_uid, std::pair<nimble_command, _nimble_cmd_fact_cb>>(
-				m_last, std::pair<nimble_command, _nimble_cmd_fact_cb>(command, 
-				nimble_command_factory::_remove)));
+			m_last = nimble_object_factory<nimble_command, nimble_storage_pool<nimble_command>, 
+				nimble_lock_policy>::generate();
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_last.to_string(true)));
 			return m_last;
@@ -479,6 +1175,11 @@ namespace NIMBLE {
 		void 
 		_nimble_command_factory::initialize(void)
 		{
+			sigset_t mask;
+			std::string log;
+			const char *path = NULL;
+			struct epoll_event event;
+
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -488,9 +1189,67 @@ namespace NIMBLE {
 				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_INITIALIZED);
 			}
 
-			m_initialized = true;
+			sigemptyset(&mask);
+			sigaddset(&mask, SIGCHLD);
+
+			if(sigprocmask(SIG_BLOCK, &mask, NULL) == INVALID_TYPE(int)) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL), errno);
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL,
+					"err. 0x%x", errno);
+			}
+
+			m_job_signal = signalfd(FD_INVALID, &mask, SFD_CLOEXEC | SFD_NONBLOCK);
+			if(m_job_signal == FD_INVALID) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL), errno);
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL,
+					"err. 0x%x", errno);
+			}
+
+			event.events = EPOLLIN;
+			event.data.fd = m_job_signal;
+
+			m_job_poll = epoll_create1(EPOLL_CLOEXEC);
+			if((m_job_poll == FD_INVALID)
+					|| (epoll_ctl(m_job_poll, EPOLL_CTL_ADD, m_job_signal, &event) 
+						== INVALID_TYPE(int))) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL), errno);
+
+				if(m_job_poll != FD_INVALID) {
+					close(m_job_poll);
+					m_job_poll = FD_INVALID;
+				}
+
+				close(m_job_signal);
+				m_job_signal = FD_INVALID;
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_ALLOCATED_SIGNAL,
+					"err. 0x%x", errno);
+			}
+
+			nimble_object_factory<nimble_command, nimble_storage_pool<nimble_command>, 
+				nimble_lock_policy>::initialize();
+			m_job.clear();
+			m_job_pid.clear();
 			m_last = UID_INVALID;
-			m_map.clear();
+
+			path = getenv(TIME_LOG_ENV);
+			if(path && *path) {
+				log = path;
+				m_time_format = ((log.size() >= std::string(TIME_LOG_JSON_EXT).size())
+						&& !log.compare(log.size() - std::string(TIME_LOG_JSON_EXT).size(), 
+							std::string(TIME_LOG_JSON_EXT).size(), TIME_LOG_JSON_EXT)) 
+					? TIME_FORMAT_JSON : TIME_FORMAT_CSV;
+				m_time_log.open(log.c_str(), std::ios::out | std::ios::app);
+
+				if(!m_time_log.is_open()) {
+					TRACE_MESSAGE(TRACE_WARNING, "Failed to open time log: %s", CHK_STR(log));
+				} else if((m_time_format == TIME_FORMAT_CSV) 
+						&& !m_time_log.seekp(0, std::ios::end).tellp()) {
+					m_time_log << nimble_command::time_header() << std::endl;
+				}
+			}
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Command component instance initialized");
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -509,13 +1268,126 @@ namespace NIMBLE {
 			return result;
 		}
 
-		bool 
-		_nimble_command_factory::is_initialized(void)
+		std::string 
+		_nimble_command_factory::job_as_string(
+			__in size_t job
+			)
 		{
+			std::stringstream result, state;
+			std::map<size_t, std::pair<nimble_uid, pid_t>>::iterator iter;
+
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_initialized);
-			return m_initialized;
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
+			}
+
+			iter = m_job.find(job);
+			if(iter == m_job.end()) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_INVALID_JOB), job);
+				THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(NIMBLE_COMMAND_EXCEPTION_INVALID_JOB,
+					"%lu", job);
+			}
+
+			nimble_command &command = at(iter->second.first);
+
+			if(command.is_active()) {
+				state << (command.is_stopped() ? "Stopped" : "Running");
+			} else {
+				state << nimble_command_factory::_result_as_string(command.result());
+			}
+
+			result << "[" << iter->first << "] " << iter->second.second << " " 
+				<< std::left << std::setw(JOB_STATE_WIDTH) << state.str() 
+				<< command.text();
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
+			return CHK_STR(result.str());
+		}
+
+		void 
+		_nimble_command_factory::job_remove(
+			__in size_t job
+			)
+		{
+			std::map<size_t, std::pair<nimble_uid, pid_t>>::iterator iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
+			}
+
+			iter = m_job.find(job);
+			if(iter != m_job.end()) {
+				TRACE_MESSAGE(TRACE_INFORMATION, "Removing job: %lu", job);
+				m_job_pid.erase(iter->second.second);
+				time_report(at(iter->second.first));
+				decrement_reference(iter->second.first);
+				m_job.erase(iter);
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		size_t 
+		_nimble_command_factory::poll(void)
+		{
+			pid_t pid;
+			int value;
+			struct rusage usage;
+			size_t job, result = 0;
+			struct epoll_event event;
+			struct signalfd_siginfo info;
+			std::map<pid_t, size_t>::iterator iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(epoll_wait(m_job_poll, &event, 1, 0) > 0) {
+
+				while(read(m_job_signal, &info, sizeof(info)) == sizeof(info));
+
+				for(;;) {
+
+					pid = wait4(PID_INVALID, &value, WNOHANG | WUNTRACED | WCONTINUED, &usage);
+					if(pid <= 0) {
+						break;
+					}
+
+					iter = m_job_pid.find(pid);
+					if(iter == m_job_pid.end()) {
+						continue;
+					}
+
+					job = iter->second;
+					nimble_command &command = at(m_job.find(job)->second.first);
+
+					if(command.status(value, &usage)) {
+						std::cout << job_as_string(job) << std::endl;
+						job_remove(job);
+						++result;
+					} else if(command.is_stopped()) {
+						std::cout << job_as_string(job) << std::endl;
+					}
+				}
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
 		}
 
 		void 
@@ -525,8 +1397,11 @@ namespace NIMBLE {
 			__out bool &update
 			)
 		{
-			std::map<nimble_uid, std::pair<nimble_command, 
-					_nimble_cmd_fact_cb>>::iterator iter;
+			size_t job, pos;
+			uint8_t time = 0;
+			bool background = false;
+			std::string text = command;
+			nimble_command_ptr entry = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -537,17 +1412,118 @@ namespace NIMBLE {
 				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
 			}
 
-			iter = find(uid);
-			TRACE_MESSAGE(TRACE_INFORMATION, "Running command \'%s\'", CHK_STR(command));
-			iter->second.first.run(command, iter->second.second, update);
+			entry = &at(uid);
+
+			pos = text.find_first_not_of(JOB_WHITESPACE);
+			if((pos != std::string::npos)
+					&& !text.compare(pos, std::string(CMD_TIME).size(), CMD_TIME)
+					&& (((pos + std::string(CMD_TIME).size()) == text.size())
+						|| std::string(JOB_WHITESPACE).find(text.at(pos 
+							+ std::string(CMD_TIME).size())) != std::string::npos)) {
+				time |= TIME_FLAG_REPORT;
+				text = text.substr(pos + std::string(CMD_TIME).size());
+
+				pos = text.find_first_not_of(JOB_WHITESPACE);
+				text = ((pos != std::string::npos) ? text.substr(pos) : std::string());
+			}
+
+			if(m_time_log.is_open()) {
+				time |= TIME_FLAG_LOG;
+			}
+
+			if(!run_builtin(uid, text)) {
+
+				background = run_background(text);
+
+				TRACE_MESSAGE(TRACE_INFORMATION, "Running command \'%s\'%s", CHK_STR(text),
+					background ? " (background)" : "");
+				nimble::acquire()->environment_export();
+				entry->run(text, nimble_command_factory::_remove, update, background, FD_INVALID, 
+					time);
+
+				if(background) {
+					job = (m_job.empty() ? (JOB_INVALID + 1) : (m_job.rbegin()->first + 1));
+					m_job.insert(std::pair<size_t, std::pair<nimble_uid, pid_t>>(job, 
+						std::pair<nimble_uid, pid_t>(uid, entry->pid())));
+					m_job_pid.insert(std::pair<pid_t, size_t>(entry->pid(), job));
+					m_last = UID_INVALID;
+					std::cout << "[" << job << "] " << entry->pid() << std::endl;
+				}
+			}
 
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
-		size_t 
-		_nimble_command_factory::size(void)
+		bool 
+		_nimble_command_factory::run_background(
+			__inout std::string &command
+			)
 		{
-			size_t result;
+			bool assignment = false, result = false;
+			size_t position = std::string::npos;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(command.find(CHAR_MODE) != std::string::npos) {
+
+				try {
+					nimble_lexer lex(command);
+
+					while(lex.has_next_token()) {
+						nimble_token &tok = lex.move_next_token();
+
+						if(tok.type() == TOKEN_END) {
+							break;
+						} else if((tok.type() == TOKEN_SYMBOL) 
+								&& (tok.subtype() == SYMBOL_ASSIGNMENT)) {
+							assignment = true;
+						}
+
+						position = std::string::npos;
+						if((tok.type() == TOKEN_LITERAL) 
+								&& !tok.text().empty()
+								&& (tok.text().back() == CHAR_MODE)
+								&& (command.at(tok.position()) != CHAR_LITERAL_STRING_DELIMITER)) {
+							position = (tok.position() + tok.text().size() - 1);
+						}
+					}
+				} catch(nimble_exception &exc) {
+					TRACE_MESSAGE(TRACE_WARNING, "%s", CHK_STR(exc.to_string(true)));
+					position = std::string::npos;
+				}
+
+				if(position != std::string::npos) {
+
+					if(assignment) {
+						TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+							NIMBLE_COMMAND_EXCEPTION_INVALID_BACKGROUND), CHK_STR(command));
+						THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+							NIMBLE_COMMAND_EXCEPTION_INVALID_BACKGROUND, "%s", CHK_STR(command));
+					}
+
+					command = command.substr(0, position);
+					command = command.substr(0, command.find_last_not_of(JOB_WHITESPACE) + 1);
+					result = true;
+				}
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
+		}
+
+		bool 
+		_nimble_command_factory::run_builtin(
+			__in const nimble_uid &uid,
+			__in const std::string &command
+			)
+		{
+			size_t position, start, workers = std::thread::hardware_concurrency();
+			bool json = false, quote, result = true, verbose = false;
+			std::stringstream stream(command);
+			std::string argument, line, name, path;
+			std::vector<std::string> arguments;
+			std::vector<std::string>::iterator argument_iter;
+			std::map<size_t, std::pair<nimble_uid, pid_t>>::iterator iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -558,12 +1534,342 @@ namespace NIMBLE {
 				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_map.size();
+			stream >> name;
 
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			if((name != CMD_BACKGROUND) 
+					&& (name != CMD_FOREGROUND)
+					&& (name != CMD_JOBS)
+					&& (name != CMD_PARALLEL)
+					&& (name != CMD_STATS)
+					&& (name != CMD_TRACE)
+					&& (name != CMD_WAIT)) {
+				result = false;
+			} else {
+				TRACE_MESSAGE(TRACE_INFORMATION, "Running builtin \'%s\'", CHK_STR(command));
+
+				if(name == CMD_PARALLEL) {
+
+					for(;;) {
+						position = (size_t) stream.tellg();
+
+						if(!(stream >> argument)) {
+							break;
+						} else if(argument == PAR_FLAG_WORKER) {
+
+							if(!(stream >> workers) || !workers) {
+								TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT), PAR_FLAG_WORKER);
+								THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT, "%s", PAR_FLAG_WORKER);
+							}
+						} else if(argument == PAR_FLAG_FILE) {
+
+							if(!(stream >> path)) {
+								TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT), PAR_FLAG_FILE);
+								THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT, "%s", PAR_FLAG_FILE);
+							}
+						} else if(argument == PAR_FLAG_VERBOSE) {
+							verbose = true;
+						} else {
+							stream.clear();
+							stream.seekg((std::streamoff) position);
+							break;
+						}
+					}
+
+					if(!path.empty()) {
+
+						std::ifstream file(path.c_str(), std::ios::in);
+						if(!file) {
+							TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT), CHK_STR(path));
+							THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT, "%s", CHK_STR(path));
+						}
+
+						while(std::getline(file, line)) {
+							start = line.find_first_not_of(JOB_WHITESPACE);
+
+							if((start != std::string::npos) 
+									&& (line.at(start) != CHAR_COMMENT)) {
+								arguments.push_back(line.substr(start, 
+									line.find_last_not_of(JOB_WHITESPACE) - start + 1));
+							}
+						}
+					}
+
+					std::getline(stream, line);
+
+					for(start = 0, position = 0, quote = false; position <= line.size(); 
+							++position) {
+
+						if((position < line.size())
+								&& (line.at(position) == CHAR_LITERAL_STRING_DELIMITER)) {
+							quote = !quote;
+						} else if((position == line.size()) 
+								|| (!quote && (line.at(position) == CHAR_SEPERATOR))) {
+							argument = line.substr(start, position - start);
+							start = argument.find_first_not_of(JOB_WHITESPACE);
+
+							if(start != std::string::npos) {
+								arguments.push_back(argument.substr(start, 
+									argument.find_last_not_of(JOB_WHITESPACE) - start + 1));
+							}
+
+							start = position + 1;
+						}
+					}
+				} else {
+
+					while(stream >> argument) {
+						arguments.push_back(argument);
+					}
+				}
+
+				decrement_reference(uid);
+				poll();
+
+				if(name == CMD_PARALLEL) {
+					run_parallel(arguments, workers, verbose);
+				} else if(name == CMD_JOBS) {
+
+					for(iter = m_job.begin(); iter != m_job.end(); ++iter) {
+						std::cout << job_as_string(iter->first) << std::endl;
+					}
+				} else if(name == CMD_STATS) {
+
+					for(argument_iter = arguments.begin(); argument_iter != arguments.end();
+							++argument_iter) {
+						argument = *argument_iter;
+
+						if(argument != STATS_FLAG_JSON) {
+							TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT), 
+								CHK_STR(argument));
+							THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT, "%s", 
+								CHK_STR(argument));
+						}
+
+						json = true;
+					}
+
+					std::cout << nimble::acquire()->stats_as_string(json) << std::endl;
+				} else if(name == CMD_TRACE) {
+
+					if(!arguments.empty() && (arguments.front() == TRACE_FLAG_PROFILE)) {
+
+						if(arguments.size() == 1) {
+							std::cout << nimble_trace::profile_as_string() << std::endl;
+						} else if((arguments.size() == 2) && (arguments.back() == TRACE_PROFILE_ON)) {
+
+							if(nimble_trace::level_max() < TRACE_LEVEL_PROFILE) {
+								TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_PROFILE), 
+									CHK_STR(arguments.back()));
+								THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_PROFILE, "%s", 
+									CHK_STR(arguments.back()));
+							}
+
+							nimble_trace::set_profile(true);
+						} else if((arguments.size() == 2) && (arguments.back() == TRACE_PROFILE_OFF)) {
+							nimble_trace::set_profile(false);
+						} else if((arguments.size() == 2) 
+								&& (arguments.back() == TRACE_PROFILE_RESET)) {
+							nimble_trace::profile_reset();
+						} else {
+							TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT), 
+								CHK_STR(arguments.back()));
+							THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT, "%s", 
+								CHK_STR(arguments.back()));
+						}
+					} else {
+
+						if(!arguments.empty() && (arguments.size() <= 2) 
+								&& (nimble_trace::level(arguments.back()) > nimble_trace::level_max())) {
+							TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_LEVEL), 
+								CHK_STR(arguments.back()));
+							THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+								NIMBLE_COMMAND_EXCEPTION_INVALID_LEVEL, "%s", 
+								CHK_STR(arguments.back()));
+						}
+
+						switch(arguments.size()) {
+							case 0:
+								std::cout << nimble_trace::level_as_string() << std::endl;
+								break;
+							case 1:
+								nimble_trace::set_level(nimble_trace::level(arguments.front()));
+								break;
+							case 2:
+								nimble_trace::set_level(nimble_trace::level(arguments.back()), 
+									nimble_trace::component(arguments.front()));
+								break;
+							default:
+								TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_COMMAND_EXCEPTION_STRING(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT), 
+									CHK_STR(arguments.back()));
+								THROW_NIMBLE_COMMAND_EXCEPTION_MESSAGE(
+									NIMBLE_COMMAND_EXCEPTION_INVALID_ARGUMENT, "%s", 
+									CHK_STR(arguments.back()));
+						}
+					}
+				} else if(name == CMD_WAIT) {
+
+					if(arguments.empty()) {
+
+						for(iter = m_job.begin(); iter != m_job.end();) {
+							nimble_command &job = at(iter->second.first);
+
+							if(!job.is_stopped() && job.wait()) {
+								job_remove((iter++)->first);
+							} else {
+								++iter;
+							}
+						}
+					} else {
+
+						for(argument_iter = arguments.begin(); argument_iter != arguments.end();
+								++argument_iter) {
+							iter = find_job(*argument_iter);
+
+							if(at(iter->second.first).wait()) {
+								job_remove(iter->first);
+							}
+						}
+					}
+				} else {
+					iter = find_job(arguments.empty() ? std::string() : arguments.front());
+					nimble_command &job = at(iter->second.first);
+
+					if(name == CMD_FOREGROUND) {
+						std::cout << job.text() << std::endl;
+						m_last = iter->second.first;
+
+						if(job.foreground()) {
+							m_last = UID_INVALID;
+							job_remove(iter->first);
+						} else {
+							std::cout << std::endl << job_as_string(iter->first) << std::endl;
+						}
+					} else {
+
+						if(job.is_stopped()) {
+							job.resume();
+						}
+
+						std::cout << job_as_string(iter->first) << std::endl;
+					}
+				}
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
 			return result;
 		}
 
+		void 
+		_nimble_command_factory::run_parallel(
+			__in const std::vector<std::string> &commands,
+			__in size_t workers,
+			__in_opt bool verbose
+			)
+		{
+			double elapsed;
+			size_t failed = 0, iter;
+			std::stringstream summary;
+			std::vector<std::thread> pool;
+			std::vector<nimble_uid> uids;
+			std::chrono::steady_clock::time_point begin;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+
+			if(!m_initialized) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_COMMAND_EXCEPTION_STRING(
+					NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED));
+				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(!workers) {
+				workers = 1;
+			}
+
+			if(workers > commands.size()) {
+				workers = commands.size();
+			}
+
+			nimble_cmd_par_ctx context(commands.size(), workers);
+
+			for(iter = 0; iter < commands.size(); ++iter) {
+				uids.push_back(generate());
+				context.command.at(iter) = &at(uids.back());
+				context.command.at(iter)->text() = commands.at(iter);
+				context.queue.at(iter % workers).push_back(iter);
+			}
+
+			m_last = UID_INVALID;
+			TRACE_MESSAGE(TRACE_INFORMATION, "Running %lu commands in parallel, workers. %lu",
+				commands.size(), workers);
+			nimble::acquire()->environment_export();
+			std::cout.flush();
+			std::cerr.flush();
+			begin = std::chrono::steady_clock::now();
+
+			for(iter = 0; iter < workers; ++iter) {
+				pool.push_back(std::thread(nimble_command_factory::_run_parallel_worker, 
+					&context, iter));
+			}
+
+			for(iter = 0; iter < commands.size(); ++iter) {
+
+				{
+					std::unique_lock<std::mutex> lock(context.lock);
+
+					while(!context.complete.at(iter)) {
+						context.signal.wait(lock);
+					}
+				}
+
+				std::cout << context.output.at(iter);
+
+				if(context.status.at(iter)) {
+					++failed;
+				}
+
+				if(verbose || context.status.at(iter)) {
+					std::cout << "[" << (iter + 1) << "] " << std::left << std::setw(JOB_STATE_WIDTH) 
+						<< nimble_command_factory::_result_as_string(context.status.at(iter))
+						<< commands.at(iter) << std::endl;
+				}
+
+				std::cout.flush();
+			}
+
+			for(iter = 0; iter < pool.size(); ++iter) {
+				pool.at(iter).join();
+			}
+
+			elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+			for(iter = 0; iter < uids.size(); ++iter) {
+				decrement_reference(uids.at(iter));
+			}
+
+			summary << CMD_PARALLEL << ": " << commands.size() << " jobs, " << failed 
+				<< " failed, " << workers << " workers, " << std::fixed << std::setprecision(3) 
+				<< elapsed << " s, " << (elapsed > 0.0 ? (commands.size() / elapsed) : 0.0) 
+				<< " jobs/s";
+			std::cout << summary.str() << std::endl;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
 		void 
 		_nimble_command_factory::stop_last(
 			__in_opt int sig
@@ -580,42 +1886,42 @@ namespace NIMBLE {
 
 			if(contains(m_last)) {
 				TRACE_MESSAGE(TRACE_INFORMATION, "Stopping last process, sig. 0x%x", sig);
-				find(m_last)->second.first.stop(sig);
+				at(m_last).stop(sig);
 			}
 
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
-		std::string 
-		_nimble_command_factory::to_string(
-			__in_opt bool verbose
+		void 
+		_nimble_command_factory::time_report(
+			__in nimble_command &command
 			)
 		{
-			std::stringstream result;
-			std::map<nimble_uid, std::pair<nimble_command, 
-					_nimble_cmd_fact_cb>>::iterator iter;
+			nimble_command_time &time = command.time();
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			result << "(" << (m_initialized ? "INIT" : "UNINIT") << ") " << NIMBLE_COMMAND_HEADER 
-				<< "[" << m_map.size() << "]";
+			if(time.flag && time.phase[TIME_PHASE_TOTAL]) {
 
-			if(verbose) {
-				result << " (" << VAL_AS_HEX(nimble_command_factory_ptr, this) << ")";
+				if(time.flag & TIME_FLAG_REPORT) {
+					std::cerr << command.time_as_string(TIME_FORMAT_TEXT) << std::endl;
+				}
 
-				for(iter = m_map.begin(); iter != m_map.end(); ++iter) {
-					result << std::endl << "--- " << iter->second.first.to_string(verbose);
+				if((time.flag & TIME_FLAG_LOG) && m_time_log.is_open()) {
+					m_time_log << command.time_as_string(m_time_format) << std::endl;
 				}
 			}
 
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
-			return CHK_STR(result.str());
+			time.flag = 0;
+
+			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
 		void 
 		_nimble_command_factory::uninitialize(void)
 		{
+			sigset_t mask;
+
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
 
@@ -625,9 +1931,30 @@ namespace NIMBLE {
 				THROW_NIMBLE_COMMAND_EXCEPTION(NIMBLE_COMMAND_EXCEPTION_UNINITIALIZED);
 			}
 
+			m_job.clear();
+			m_job_pid.clear();
 			m_last = UID_INVALID;
-			m_map.clear();
-			m_initialized = false;
+
+			if(m_time_log.is_open()) {
+				m_time_log.close();
+			}
+
+			nimble_object_factory<nimble_command, nimble_storage_pool<nimble_command>, 
+				nimble_lock_policy>::uninitialize();
+
+			if(m_job_poll != FD_INVALID) {
+				close(m_job_poll);
+				m_job_poll = FD_INVALID;
+			}
+
+			if(m_job_signal != FD_INVALID) {
+				close(m_job_signal);
+				m_job_signal = FD_INVALID;
+			}
+
+			sigemptyset(&mask);
+			sigaddset(&mask, SIGCHLD);
+			sigprocmask(SIG_UNBLOCK, &mask, NULL);
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Command component instance uninitialized");
 
 			TRACE_EXIT(TRACE_VERBOSE);
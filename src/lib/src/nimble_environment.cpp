@@ -17,14 +17,25 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <cstddef>
+#include <cerrno>
 #include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "../include/nimble.h"
 #include "../include/nimble_environment_type.h"
 
 namespace NIMBLE {
 
-	#define ENV_ENTRY_MAX UINT16_MAX
+	#define ENV_DESCRIPTOR_INVALID INVALID_TYPE(int32_t)
+	#define ENV_GENERATION_INVALID 0
+	#define ENV_HASH_BASIS 0x811c9dc5
+	#define ENV_HASH_PRIME 0x01000193
+	#define ENV_MAP_EMPTY INVALID_TYPE(uint32_t)
+	#define ENV_MAP_LOAD 2
+	#define ENV_MEM_NAME "nimble_environment"
+	#define ENV_RCU_EPOCH_IDLE 0
+	#define ENV_RCU_SLOT_INVALID INVALID_TYPE(size_t)
+	#define ENV_SLOT_RATIO 64
 
 	#define ENV_FLG_CHECK(_F_, _FLG_) ((_F_) & (_FLG_))
 	#define ENV_FLG_CLEAR(_F_, _FLG_) ((_F_) &= ~(_FLG_))
@@ -32,12 +43,63 @@ namespace NIMBLE {
 
 	typedef struct __attribute__((__packed__)) _nimble_environment_header {
 		uint8_t flag;
+		uint16_t count;
+		uint16_t slots;
+		uint32_t buckets;
 		uint32_t size;
+		uint32_t capacity;
+		int32_t descriptor;
+		uint32_t generation;
+		uint32_t heap;
 		uint32_t position;
-		uint16_t count;
-		char **pairs;
+		uint64_t time[ENV_TIME_MAX + 1];
 	} nimble_environment_header, *nimble_environment_header_ptr;
 
+	typedef struct __attribute__((__packed__)) _nimble_environment_entry {
+		uint8_t action;
+		uint32_t hash;
+		uint32_t field;
+		uint32_t field_length;
+		uint32_t value;
+		uint32_t value_length;
+	} nimble_environment_entry, *nimble_environment_entry_ptr;
+
+	typedef struct __attribute__((__packed__)) _nimble_environment_bucket {
+		uint32_t generation;
+		uint16_t position;
+	} nimble_environment_bucket, *nimble_environment_bucket_ptr;
+
+	#define ENV_BUCKET(_HEAD_) \
+		((nimble_environment_bucket_ptr) (ENV_TABLE(_HEAD_) + (_HEAD_)->slots))
+	#define ENV_DATA(_HEAD_, _OFF_) ((char *) (_HEAD_) + (_OFF_))
+	#define ENV_TABLE(_HEAD_) \
+		((nimble_environment_entry_ptr) ((char *) (_HEAD_) + sizeof(nimble_environment_header)))
+
+	#define ENV_BUCKET_COUNT(_SLOTS_, _RES_) { \
+		for((_RES_) = 1; (_RES_) < (2 * (uint32_t) (_SLOTS_)); (_RES_) <<= 1); \
+		}
+	#define ENV_HEAP_OFFSET(_SLOTS_, _BUCKETS_) \
+		(sizeof(nimble_environment_header) + ((_SLOTS_) * sizeof(nimble_environment_entry)) \
+		+ ((_BUCKETS_) * sizeof(nimble_environment_bucket)))
+
+	static std::atomic<bool> environment_rcu_owned[ENV_RCU_READERS];
+
+	typedef struct _nimble_environment_rcu_slot {
+
+		~_nimble_environment_rcu_slot(void)
+		{
+
+			if(position != ENV_RCU_SLOT_INVALID) {
+				environment_rcu_owned[position].store(false, std::memory_order_release);
+			}
+		}
+
+		size_t position;
+	} nimble_environment_rcu_slot;
+
+	static thread_local nimble_environment_rcu_slot environment_rcu_slot = { 
+		ENV_RCU_SLOT_INVALID };
+
 	void 
 	_nimble_environment::add(
 		__in void *context,
@@ -45,57 +107,172 @@ namespace NIMBLE {
 		__in const std::string &value
 		)
 	{
+		uint16_t position;
+		uint32_t bucket, hash;
+		nimble_environment_entry_ptr entry = NULL;
 		nimble_environment_header_ptr head = NULL;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
 
 		nimble_environment::validate(context);
 		head = (nimble_environment_header_ptr) context;
+		hash = nimble_environment::hash(field.c_str(), field.size());
 
-		if((head->position + field.size() + value.size() + 2) >= head->size) {
-			TRACE_MESSAGE(TRACE_ERROR, "%s", 
-				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES));
-			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES);
+		position = nimble_environment::lookup(context, field.c_str(), field.size(), 
+			hash, &bucket);
+
+		if(position == ENV_ENTRY_INVALID) {
+			position = nimble_environment::insert(context, field, hash, bucket, ENV_ACTION_SET);
+		}
+
+		entry = &ENV_TABLE(head)[position];
+
+		if(value.size() <= entry->value_length) {
+			memcpy(ENV_DATA(head, entry->value), value.c_str(), value.size() + 1);
+		} else {
+			entry->value = nimble_environment::append(context, value.c_str(), value.size());
 		}
 
-		strcpy((char *) head + head->position, field.c_str());
-		head->position += (field.size() + 1);
-		strcpy((char *) head + head->position, value.c_str());
-		head->position += (value.size() + 1);
-		++head->count;
+		entry->action = ENV_ACTION_SET;
+		entry->value_length = value.size();
 
 		TRACE_EXIT(TRACE_VERBOSE);
 	}
 
+	void *
+	_nimble_environment::allocate(
+		__in_opt uint16_t slots,
+		__in_opt uint32_t capacity
+		)
+	{
+		int descriptor;
+		void *result = NULL;
+		uint32_t buckets, size;
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		ENV_BUCKET_COUNT(slots, buckets);
+		size = ENV_HEAP_OFFSET(slots, buckets) + ENV_MEM_LEN;
+
+		if(!slots || (slots > ENV_ENTRY_MAX) || (size > capacity)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, slots. %lu, cap. %lu", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED),
+				slots, capacity);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED,
+				"slots. %lu, cap. %lu", slots, capacity);
+		}
+
+		descriptor = memfd_create(ENV_MEM_NAME, MFD_CLOEXEC);
+		if(descriptor == ENV_DESCRIPTOR_INVALID) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED),
+				errno);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED,
+				"err. 0x%x", errno);
+		}
+
+		if(ftruncate(descriptor, size) == INVALID_TYPE(int)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED),
+				errno);
+			close(descriptor);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED,
+				"err. 0x%x", errno);
+		}
+
+		result = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, 
+			descriptor, 0);
+
+		if(!result || (result == MAP_FAILED)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED),
+				errno);
+			close(descriptor);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_ALLOCATED,
+				"err. 0x%x", errno);
+		}
+
+		head = (nimble_environment_header_ptr) result;
+		head->flag = 0;
+		head->count = 0;
+		head->slots = slots;
+		head->buckets = buckets;
+		head->size = size;
+		head->capacity = capacity;
+		head->descriptor = descriptor;
+		head->generation = (ENV_GENERATION_INVALID + 1);
+		head->heap = ENV_HEAP_OFFSET(slots, buckets);
+		head->position = head->heap;
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p", result);
+		return result;
+	}
+
+	uint32_t 
+	_nimble_environment::append(
+		__in void *context,
+		__in const char *data,
+		__in uint32_t length
+		)
+	{
+		uint32_t result;
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		head = (nimble_environment_header_ptr) context;
+
+		if((head->position + length + 1) >= head->size) {
+			nimble_environment::grow(context, head->position + length + 1);
+		}
+
+		result = head->position;
+		memcpy(ENV_DATA(head, result), data, length);
+		ENV_DATA(head, result)[length] = '\0';
+		head->position += (length + 1);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
 	std::string 
 	_nimble_environment::as_string(
 		__in void *context,
 		__in_opt bool verbose
 		)
 	{
-		char **str = NULL;
 		uint16_t iter = 0;
 		std::stringstream result;
-		std::string field, value;
+		uint32_t field_length, value_length;
+		const char *field = NULL, *value = NULL;
 		nimble_environment_header_ptr head = NULL;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
 
 		nimble_environment::validate(context);
 		head = (nimble_environment_header_ptr) context;
-		result << "ENV[" << head->count << "], flg. 0x" << VAL_AS_HEX(uint8_t, head->flag);
+		result << "ENV[" << head->count << "/" << head->slots << "], flg. 0x" 
+			<< VAL_AS_HEX(uint8_t, head->flag);
 
 		if(verbose) {
-			result << " (" << head->size << " bytes, pos. " 
-				<< head->position << ") ";
+			result << " (" << head->size << "/" << head->capacity << " bytes, heap. " 
+				<< head->heap << ", pos. " << head->position << ", gen. " 
+				<< head->generation << ") ";
 		}
 
 		result << "{";
-		str = head->pairs;
 
 		for(; iter < head->count; ++iter) {
-			nimble_environment::at(context, iter, field, value);
-			result << std::endl << "\t" << field << " --> " << value;
+			result << std::endl << "\t";
+
+			if(nimble_environment::at(context, iter, field, field_length, value, value_length) 
+					== ENV_ACTION_REMOVE) {
+				result << "-" << std::string(field, field_length);
+			} else {
+				result << std::string(field, field_length) << " --> " 
+					<< std::string(value, value_length);
+			}
 		}
 
 		if(iter) {
@@ -116,9 +293,31 @@ namespace NIMBLE {
 		__out std::string &value
 		)
 	{
-		char *base = NULL;
-		uint16_t iter = 0;
-		uint32_t offset = 0;
+		const char *field_data = NULL, *value_data = NULL;
+		uint32_t field_length, value_length;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::at(context, position, field_data, field_length, value_data, 
+			value_length);
+		field.assign(field_data, field_length);
+		value.assign(value_data, value_length);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s --> %s", CHK_STR(field), CHK_STR(value));
+	}
+
+	uint8_t 
+	_nimble_environment::at(
+		__in void *context,
+		__in uint16_t position,
+		__out const char *&field,
+		__out uint32_t &field_length,
+		__out const char *&value,
+		__out uint32_t &value_length
+		)
+	{
+		uint8_t result;
+		nimble_environment_entry_ptr entry = NULL;
 		nimble_environment_header_ptr head = NULL;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
@@ -134,16 +333,15 @@ namespace NIMBLE {
 				"pos. %lu", position);
 		}
 
-		base = (char *) head + offsetof(nimble_environment_header, pairs);
-
-		for(; iter <= position; ++iter) {
-			field = base + offset;
-			offset += (field.size() + 1);
-			value = base + offset;
-			offset += (value.size() + 1);
-		}
+		entry = &ENV_TABLE(head)[position];
+		field = ENV_DATA(head, entry->field);
+		field_length = entry->field_length;
+		value = ENV_DATA(head, entry->value);
+		value_length = entry->value_length;
+		result = entry->action;
 
-		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s --> %s", CHK_STR(field), CHK_STR(value));
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x, %s --> %s", result, field, value);
+		return result;
 	}
 
 	uint16_t 
@@ -162,6 +360,24 @@ namespace NIMBLE {
 		return result;
 	}
 
+	uint16_t 
+	_nimble_environment::find(
+		__in void *context,
+		__in const std::string &field
+		)
+	{
+		uint16_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+		result = nimble_environment::lookup(context, field.c_str(), field.size(), 
+			nimble_environment::hash(field.c_str(), field.size()));
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
 	void 
 	_nimble_environment::flag_clear(
 		__in void *context,
@@ -212,12 +428,89 @@ namespace NIMBLE {
 		TRACE_EXIT(TRACE_VERBOSE);
 	}
 
+	uint32_t 
+	_nimble_environment::generation(
+		__in void *context
+		)
+	{
+		uint32_t result = 0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+		result = ((nimble_environment_header_ptr) context)->generation;
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble_environment::grow(
+		__in void *context,
+		__in uint32_t size
+		)
+	{
+		uint64_t length;
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+		head = (nimble_environment_header_ptr) context;
+
+		if((head->descriptor == ENV_DESCRIPTOR_INVALID) 
+				|| (size >= head->capacity)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES));
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES);
+		}
+
+		for(length = head->size; length <= size; length *= 2);
+
+		if(length > head->capacity) {
+			length = head->capacity;
+		}
+
+		if(ftruncate(head->descriptor, length) == INVALID_TYPE(int)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, err. 0x%x", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES),
+				errno);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES,
+				"err. 0x%x", errno);
+		}
+
+		TRACE_MESSAGE(TRACE_INFORMATION, "Environment grown %lu -> %lu bytes", head->size, 
+			length);
+		head->size = length;
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	uint32_t 
+	_nimble_environment::hash(
+		__in const char *data,
+		__in size_t length
+		)
+	{
+		size_t iter = 0;
+		uint32_t result = ENV_HASH_BASIS;
+
+		for(; iter < length; ++iter) {
+			result ^= (uint8_t) data[iter];
+			result *= ENV_HASH_PRIME;
+		}
+
+		return result;
+	}
+
 	void 
 	_nimble_environment::initialize(
 		__inout void *context,
 		__in size_t size
 		)
 	{
+		uint32_t buckets;
+		uint16_t slots;
 		nimble_environment_header_ptr head = NULL;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
@@ -228,15 +521,74 @@ namespace NIMBLE {
 			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID);
 		}
 
+		slots = ((size / ENV_SLOT_RATIO) > ENV_ENTRY_MAX) ? ENV_ENTRY_MAX : 
+			(size / ENV_SLOT_RATIO);
+		ENV_BUCKET_COUNT(slots, buckets);
+
+		if(!slots || (ENV_HEAP_OFFSET(slots, buckets) >= size)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, size. %lu", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES),
+				size);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES,
+				"size. %lu", size);
+		}
+
 		memset(context, 0, size);
 		head = (nimble_environment_header_ptr) context;
 		head->flag = 0;
+		head->count = 0;
+		head->slots = slots;
+		head->buckets = buckets;
 		head->size = size;
-		head->position = offsetof(nimble_environment_header, pairs);
+		head->capacity = size;
+		head->descriptor = ENV_DESCRIPTOR_INVALID;
+		head->generation = (ENV_GENERATION_INVALID + 1);
+		head->heap = ENV_HEAP_OFFSET(slots, buckets);
+		head->position = head->heap;
 
 		TRACE_EXIT(TRACE_VERBOSE);
 	}
 
+	uint16_t 
+	_nimble_environment::insert(
+		__in void *context,
+		__in const std::string &field,
+		__in uint32_t hash,
+		__in uint32_t bucket,
+		__in uint8_t action
+		)
+	{
+		uint16_t result;
+		nimble_environment_entry_ptr entry = NULL;
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		head = (nimble_environment_header_ptr) context;
+
+		if(head->count >= head->slots) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s, slots. %lu", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES),
+				head->slots);
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES,
+				"slots. %lu", head->slots);
+		}
+
+		result = head->count++;
+		entry = &ENV_TABLE(head)[result];
+		entry->action = action;
+		entry->hash = hash;
+		entry->field = nimble_environment::append(context, field.c_str(), field.size());
+		entry->field_length = field.size();
+		entry->value = nimble_environment::append(context, "", 0);
+		entry->value_length = 0;
+		ENV_BUCKET(head)[bucket].generation = head->generation;
+		ENV_BUCKET(head)[bucket].position = result;
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
 	bool 
 	_nimble_environment::is_flag_set(
 		__in void *context,
@@ -264,45 +616,1053 @@ namespace NIMBLE {
 		return result;
 	}
 
-	uint32_t 
-	_nimble_environment::size(
-		__in void *context
+	uint16_t 
+	_nimble_environment::lookup(
+		__in void *context,
+		__in const char *field,
+		__in uint32_t length,
+		__in uint32_t hash,
+		__out_opt uint32_t *bucket
 		)
 	{
-		uint32_t result = 0;
+		uint32_t iter, mask;
+		uint16_t result = ENV_ENTRY_INVALID;
+		nimble_environment_entry_ptr entry = NULL;
+		nimble_environment_header_ptr head = NULL;
+		nimble_environment_bucket_ptr table = NULL;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
 
-		nimble_environment::validate(context);
-		result = ((nimble_environment_header_ptr) context)->size;
+		head = (nimble_environment_header_ptr) context;
+		table = ENV_BUCKET(head);
+		mask = (head->buckets - 1);
+
+		for(iter = (hash & mask); table[iter].generation == head->generation; 
+				iter = ((iter + 1) & mask)) {
+			entry = &ENV_TABLE(head)[table[iter].position];
+
+			if((entry->hash == hash) 
+					&& (entry->field_length == length)
+					&& !memcmp(ENV_DATA(head, entry->field), field, length)) {
+				result = table[iter].position;
+				break;
+			}
+		}
+
+		if(bucket) {
+			*bucket = iter;
+		}
 
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 		return result;
 	}
 
 	void 
-	_nimble_environment::validate(
+	_nimble_environment::release(
 		__in void *context
 		)
 	{
+		int32_t descriptor;
 		nimble_environment_header_ptr head = NULL;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
 
-		if(!context) {
+		nimble_environment::validate(context);
+		head = (nimble_environment_header_ptr) context;
+
+		if(head->descriptor == ENV_DESCRIPTOR_INVALID) {
 			TRACE_MESSAGE(TRACE_ERROR, "%s", 
 				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID));
 			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID);
 		}
 
+		descriptor = head->descriptor;
+		munmap(context, head->capacity);
+		close(descriptor);
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble_environment::remove(
+		__in void *context,
+		__in const std::string &field
+		)
+	{
+		uint16_t position;
+		uint32_t bucket, hash;
+		nimble_environment_entry_ptr entry = NULL;
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+		head = (nimble_environment_header_ptr) context;
+		hash = nimble_environment::hash(field.c_str(), field.size());
+
+		position = nimble_environment::lookup(context, field.c_str(), field.size(), 
+			hash, &bucket);
+
+		if(position == ENV_ENTRY_INVALID) {
+			position = nimble_environment::insert(context, field, hash, bucket, ENV_ACTION_REMOVE);
+		}
+
+		entry = &ENV_TABLE(head)[position];
+		entry->action = ENV_ACTION_REMOVE;
+		ENV_DATA(head, entry->value)[0] = '\0';
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	uint32_t 
+	_nimble_environment::reset(
+		__in void *context
+		)
+	{
+		uint32_t result = 0;
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
 		head = (nimble_environment_header_ptr) context;
-		if((head->position < offsetof(nimble_environment_header, pairs))
-				|| (head->position > head->size)) {
-			TRACE_MESSAGE(TRACE_ERROR, "%s", 
-				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID));
-			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID);
+		head->flag = 0;
+		head->count = 0;
+		head->position = head->heap;
+		memset(head->time, 0, sizeof(head->time));
+
+		if(++head->generation == ENV_GENERATION_INVALID) {
+			memset(ENV_BUCKET(head), 0, head->buckets * sizeof(nimble_environment_bucket));
+			++head->generation;
+		}
+
+		result = head->generation;
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	uint32_t 
+	_nimble_environment::size(
+		__in void *context
+		)
+	{
+		uint32_t result = 0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+		result = ((nimble_environment_header_ptr) context)->size;
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	uint64_t 
+	_nimble_environment::timing(
+		__in void *context,
+		__in uint8_t phase
+		)
+	{
+		uint64_t result = 0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+
+		if(phase <= ENV_TIME_MAX) {
+			result = ((nimble_environment_header_ptr) context)->time[phase];
 		}
 
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble_environment::timing_set(
+		__in void *context,
+		__in uint8_t phase,
+		__in uint64_t value
+		)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		nimble_environment::validate(context);
+
+		if(phase <= ENV_TIME_MAX) {
+			((nimble_environment_header_ptr) context)->time[phase] = value;
+		}
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble_environment::validate(
+		__in void *context
+		)
+	{
+		nimble_environment_header_ptr head = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(!context) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID));
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID);
+		}
+
+		head = (nimble_environment_header_ptr) context;
+		if((head->heap != ENV_HEAP_OFFSET(head->slots, head->buckets))
+				|| (head->position < head->heap)
+				|| (head->position > head->size)
+				|| (head->count > head->slots)
+				|| (head->generation == ENV_GENERATION_INVALID)) {
+			TRACE_MESSAGE(TRACE_ERROR, "%s", 
+				NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID));
+			THROW_NIMBLE_ENVIRONMENT_EXCEPTION(NIMBLE_ENVIRONMENT_EXCEPTION_INVALID);
+		}
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_environment_map::_nimble_environment_map(void) :
+		m_export_base(NULL),
+		m_version(0)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		clear();
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_environment_map::_nimble_environment_map(
+		__in const _nimble_environment_map &other
+		) :
+			m_bucket(other.m_bucket),
+			m_dirty(other.m_dirty),
+			m_entry(other.m_entry),
+			m_envp(other.m_envp),
+			m_export(other.m_export),
+			m_export_base(NULL),
+			m_version(0)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_environment_map::~_nimble_environment_map(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_environment_map &
+	_nimble_environment_map::operator=(
+		__in const _nimble_environment_map &other
+		)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(this != &other) {
+			m_bucket = other.m_bucket;
+			m_dirty = other.m_dirty;
+			m_entry = other.m_entry;
+			m_envp = other.m_envp;
+			m_export = other.m_export;
+			m_export_base = NULL;
+			++m_version;
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p", this);
+		return *this;
+	}
+
+	nimble_environment_map::iterator 
+	_nimble_environment_map::begin(void)
+	{
+		return m_entry.begin();
+	}
+
+	nimble_environment_map::const_iterator 
+	_nimble_environment_map::begin(void) const
+	{
+		return m_entry.begin();
+	}
+
+	void 
+	_nimble_environment_map::clear(void)
+	{
+		nimble_environment_map_bucket empty = { 0, ENV_MAP_EMPTY };
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		m_bucket.assign(ENV_MAP_LEN, empty);
+		m_dirty.clear();
+		m_entry.clear();
+		m_envp.assign(1, NULL);
+		m_export.clear();
+		++m_version;
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	bool 
+	_nimble_environment_map::empty(void) const
+	{
+		return m_entry.empty();
+	}
+
+	nimble_environment_map::iterator 
+	_nimble_environment_map::end(void)
+	{
+		return m_entry.end();
+	}
+
+	nimble_environment_map::const_iterator 
+	_nimble_environment_map::end(void) const
+	{
+		return m_entry.end();
+	}
+
+	char **
+	_nimble_environment_map::envp(void)
+	{
+		uint32_t iter, position;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		for(iter = 0; iter < m_dirty.size(); ++iter) {
+			position = m_dirty[iter];
+
+			if(position < m_entry.size()) {
+				m_export[position] = m_entry[position].first;
+				m_export[position] += ENV_ASSIGN;
+				m_export[position] += m_entry[position].second;
+				m_envp[position] = &m_export[position][0];
+			}
+		}
+
+		m_dirty.clear();
+
+		if(m_export.data() != m_export_base) {
+
+			for(iter = 0; iter < m_export.size(); ++iter) {
+				m_envp[iter] = &m_export[iter][0];
+			}
+
+			m_export_base = m_export.data();
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p (%lu)", &m_envp[0], m_export.size());
+		return &m_envp[0];
+	}
+
+	size_t 
+	_nimble_environment_map::erase(
+		__in const std::string &field
+		)
+	{
+		size_t result = 0;
+		uint32_t hash, ideal, iter, mask, next, position;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		iter = lookup(field, nimble_environment::hash(field.c_str(), field.size()));
+		if(m_bucket[iter].position != ENV_MAP_EMPTY) {
+			mask = (m_bucket.size() - 1);
+			position = m_bucket[iter].position;
+
+			for(next = ((iter + 1) & mask); m_bucket[next].position != ENV_MAP_EMPTY; 
+					next = ((next + 1) & mask)) {
+				ideal = (m_bucket[next].hash & mask);
+
+				if(((next - ideal) & mask) >= ((next - iter) & mask)) {
+					m_bucket[iter] = m_bucket[next];
+					iter = next;
+				}
+			}
+
+			m_bucket[iter].position = ENV_MAP_EMPTY;
+
+			if(position != (m_entry.size() - 1)) {
+				m_entry[position] = m_entry.back();
+				hash = nimble_environment::hash(m_entry[position].first.c_str(), 
+					m_entry[position].first.size());
+				m_bucket[lookup(m_entry[position].first, hash)].position = position;
+				m_dirty.push_back(position);
+			}
+
+			m_entry.pop_back();
+			m_envp.pop_back();
+			m_envp.back() = NULL;
+			m_export.pop_back();
+			++m_version;
+			result = 1;
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	nimble_environment_map::iterator 
+	_nimble_environment_map::find(
+		__in const std::string &field
+		)
+	{
+		return find(field, nimble_environment::hash(field.c_str(), field.size()));
+	}
+
+	nimble_environment_map::iterator 
+	_nimble_environment_map::find(
+		__in const std::string &field,
+		__in uint32_t hash
+		)
+	{
+		uint32_t position;
+
+		position = m_bucket[lookup(field, hash)].position;
+
+		return (position != ENV_MAP_EMPTY) ? (m_entry.begin() + position) : m_entry.end();
+	}
+
+	nimble_environment_map::const_iterator 
+	_nimble_environment_map::find(
+		__in const std::string &field
+		) const
+	{
+		return find(field, nimble_environment::hash(field.c_str(), field.size()));
+	}
+
+	nimble_environment_map::const_iterator 
+	_nimble_environment_map::find(
+		__in const std::string &field,
+		__in uint32_t hash
+		) const
+	{
+		uint32_t position;
+
+		position = m_bucket[lookup(field, hash)].position;
+
+		return (position != ENV_MAP_EMPTY) ? (m_entry.begin() + position) : m_entry.end();
+	}
+
+	std::pair<nimble_environment_map::iterator, bool> 
+	_nimble_environment_map::insert(
+		__in const nimble_environment_pair &entry
+		)
+	{
+		return insert(entry, nimble_environment::hash(entry.first.c_str(), 
+			entry.first.size()));
+	}
+
+	std::pair<nimble_environment_map::iterator, bool> 
+	_nimble_environment_map::insert(
+		__in const nimble_environment_pair &entry,
+		__in uint32_t hash
+		)
+	{
+		uint32_t iter;
+		std::pair<iterator, bool> result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(((m_entry.size() + 1) * ENV_MAP_LOAD) > m_bucket.size()) {
+			rehash(m_bucket.size() * ENV_MAP_LOAD);
+		}
+
+		iter = lookup(entry.first, hash);
+		if(m_bucket[iter].position != ENV_MAP_EMPTY) {
+			result = std::pair<iterator, bool>(m_entry.begin() + m_bucket[iter].position, 
+				false);
+		} else {
+			m_bucket[iter].hash = hash;
+			m_bucket[iter].position = m_entry.size();
+			m_dirty.push_back(m_entry.size());
+			m_entry.push_back(entry);
+			m_envp.push_back(NULL);
+			m_export.push_back(std::string());
+			++m_version;
+			result = std::pair<iterator, bool>(m_entry.end() - 1, true);
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s (%x)", CHK_STR(result.first->first), 
+			result.second);
+		return result;
+	}
+
+	uint32_t 
+	_nimble_environment_map::lookup(
+		__in const std::string &field,
+		__in uint32_t hash
+		) const
+	{
+		uint32_t mask, result;
+
+		mask = (m_bucket.size() - 1);
+
+		for(result = (hash & mask); m_bucket[result].position != ENV_MAP_EMPTY; 
+				result = ((result + 1) & mask)) {
+
+			if((m_bucket[result].hash == hash) 
+					&& (m_entry[m_bucket[result].position].first == field)) {
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	void 
+	_nimble_environment_map::rehash(
+		__in uint32_t count
+		)
+	{
+		uint32_t iter, mask, position;
+		std::vector<nimble_environment_map_bucket> bucket;
+		nimble_environment_map_bucket empty = { 0, ENV_MAP_EMPTY };
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		bucket.assign(count, empty);
+		mask = (count - 1);
+
+		for(iter = 0; iter < m_bucket.size(); ++iter) {
+
+			if(m_bucket[iter].position != ENV_MAP_EMPTY) {
+
+				for(position = (m_bucket[iter].hash & mask); 
+						bucket[position].position != ENV_MAP_EMPTY;
+						position = ((position + 1) & mask));
+
+				bucket[position] = m_bucket[iter];
+			}
+		}
+
+		m_bucket.swap(bucket);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "cnt. %lu", count);
+	}
+
+	std::pair<nimble_environment_map::iterator, bool> 
+	_nimble_environment_map::set(
+		__in const std::string &field,
+		__in const std::string &value,
+		__in uint32_t hash
+		)
+	{
+		std::pair<iterator, bool> result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = insert(nimble_environment_pair(field, value), hash);
+		if(!result.second && (result.first->second != value)) {
+			result.first->second = value;
+			m_dirty.push_back(result.first - m_entry.begin());
+			++m_version;
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s (%x)", CHK_STR(result.first->first), 
+			result.second);
+		return result;
+	}
+
+	size_t 
+	_nimble_environment_map::size(void) const
+	{
+		return m_entry.size();
+	}
+
+	size_t 
+	_nimble_environment_map::version(void) const
+	{
+		return m_version;
+	}
+
+	_nimble_environment_scope::_nimble_environment_scope(
+		__in nimble_environment_map_ptr base
+		) :
+			m_base(base),
+			m_depth(0),
+			m_dirty(true),
+			m_version(0)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_environment_scope::~_nimble_environment_scope(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble_environment_scope::clear(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		m_depth = 0;
+		m_dirty = true;
+		m_envp.clear();
+		m_layer.clear();
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	size_t 
+	_nimble_environment_scope::depth(void)
+	{
+		return m_depth;
+	}
+
+	char **
+	_nimble_environment_scope::envp(void)
+	{
+		char **base = NULL, **entry = NULL;
+		size_t iter, layer, position;
+		nimble_environment_map::iterator field;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		base = m_base->envp();
+
+		for(layer = 0; layer < m_depth; ++layer) {
+
+			if(!m_layer.at(layer).entry.empty() || !m_layer.at(layer).removed.empty()) {
+				break;
+			}
+		}
+
+		if(layer == m_depth) {
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p", base);
+			return base;
+		}
+
+		if(!m_dirty && (m_version == m_base->version())) {
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p (%lu)", &m_envp[0], m_envp.size() - 1);
+			return &m_envp[0];
+		}
+
+		m_envp.clear();
+
+		for(field = m_base->begin(), position = 0; field != m_base->end(); ++field, ++position) {
+
+			if(!shadowed(field->first, nimble_environment::hash(field->first.c_str(), 
+					field->first.size()), 0)) {
+				m_envp.push_back(base[position]);
+			}
+		}
+
+		for(layer = 0; layer < m_depth; ++layer) {
+			nimble_environment_map &map = m_layer.at(layer).entry;
+
+			entry = map.envp();
+
+			for(field = map.begin(), iter = 0; field != map.end(); ++field, ++iter) {
+
+				if(!shadowed(field->first, nimble_environment::hash(field->first.c_str(), 
+						field->first.size()), layer + 1)) {
+					m_envp.push_back(entry[iter]);
+				}
+			}
+		}
+
+		m_envp.push_back(NULL);
+		m_dirty = false;
+		m_version = m_base->version();
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%p (%lu)", &m_envp[0], m_envp.size() - 1);
+		return &m_envp[0];
+	}
+
+	bool 
+	_nimble_environment_scope::find(
+		__in const std::string &field,
+		__in uint32_t hash,
+		__out std::string &value
+		)
+	{
+		size_t layer;
+		bool result = false;
+		nimble_environment_map::iterator iter;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		for(layer = m_depth; layer > 0; --layer) {
+			nimble_environment_layer &scope = m_layer.at(layer - 1);
+
+			iter = scope.entry.find(field, hash);
+			if(iter != scope.entry.end()) {
+				value = iter->second;
+				result = true;
+				break;
+			}
+
+			if(scope.removed.find(field, hash) != scope.removed.end()) {
+				break;
+			}
+		}
+
+		if(!layer) {
+			iter = m_base->find(field, hash);
+
+			result = (iter != m_base->end());
+			if(result) {
+				value = iter->second;
+			}
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+		return result;
+	}
+
+	void 
+	_nimble_environment_scope::pop(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(m_depth) {
+			--m_depth;
+			m_dirty = true;
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "dep. %lu", m_depth);
+	}
+
+	void 
+	_nimble_environment_scope::push(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(m_depth == m_layer.size()) {
+			m_layer.push_back(nimble_environment_layer());
+		}
+
+		nimble_environment_layer &scope = m_layer.at(m_depth++);
+		m_dirty = true;
+
+		if(!scope.entry.empty()) {
+			scope.entry.clear();
+		}
+
+		if(!scope.removed.empty()) {
+			scope.removed.clear();
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "dep. %lu", m_depth);
+	}
+
+	bool 
+	_nimble_environment_scope::remove(
+		__in const std::string &field,
+		__in uint32_t hash
+		)
+	{
+		bool result;
+		std::string value;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = find(field, hash, value);
+
+		if(!m_depth) {
+			m_base->erase(field);
+		} else if(result) {
+			nimble_environment_layer &scope = m_layer.at(m_depth - 1);
+
+			scope.entry.erase(field);
+			scope.removed.insert(nimble_environment_pair(field, std::string()), hash);
+			m_dirty = true;
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+		return result;
+	}
+
+	void 
+	_nimble_environment_scope::set(
+		__in const std::string &field,
+		__in const std::string &value,
+		__in uint32_t hash
+		)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(!m_depth) {
+			m_base->set(field, value, hash);
+		} else {
+			nimble_environment_layer &scope = m_layer.at(m_depth - 1);
+
+			scope.entry.set(field, value, hash);
+			scope.removed.erase(field);
+			m_dirty = true;
+		}
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	bool 
+	_nimble_environment_scope::shadowed(
+		__in const std::string &field,
+		__in uint32_t hash,
+		__in size_t layer
+		)
+	{
+		bool result = false;
+
+		for(; layer < m_depth; ++layer) {
+			nimble_environment_layer &scope = m_layer.at(layer);
+
+			if((scope.entry.find(field, hash) != scope.entry.end())
+					|| (scope.removed.find(field, hash) != scope.removed.end())) {
+				result = true;
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	std::atomic<size_t> _nimble_environment_rcu::m_reader_count(0);
+
+	_nimble_environment_rcu::_nimble_environment_rcu(void) :
+		m_current(new nimble_environment_map),
+		m_epoch(ENV_RCU_EPOCH_IDLE + 1)
+	{
+		size_t iter = 0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		for(; iter < ENV_RCU_READERS; ++iter) {
+			m_reader[iter].epoch.store(ENV_RCU_EPOCH_IDLE);
+		}
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_environment_rcu::~_nimble_environment_rcu(void)
+	{
+		size_t iter = 0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		for(; iter < m_retired.size(); ++iter) {
+			delete m_retired.at(iter).second;
+		}
+
+		m_retired.clear();
+		delete m_current.exchange(NULL);
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	size_t 
+	_nimble_environment_rcu::_reader(void)
+	{
+		bool owned;
+		size_t count, iter = 0;
+
+		if(environment_rcu_slot.position == ENV_RCU_SLOT_INVALID) {
+
+			for(; iter < ENV_RCU_READERS; ++iter) {
+				owned = false;
+
+				if(environment_rcu_owned[iter].compare_exchange_strong(owned, true, 
+						std::memory_order_acquire)) {
+					environment_rcu_slot.position = iter;
+					break;
+				}
+			}
+
+			if(environment_rcu_slot.position == ENV_RCU_SLOT_INVALID) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, readers. %lu", 
+					NIMBLE_ENVIRONMENT_EXCEPTION_STRING(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES),
+					(size_t) ENV_RCU_READERS);
+				THROW_NIMBLE_ENVIRONMENT_EXCEPTION_MESSAGE(NIMBLE_ENVIRONMENT_EXCEPTION_RESOURCES,
+					"readers. %lu", (size_t) ENV_RCU_READERS);
+			}
+
+			count = m_reader_count.load();
+			while((count <= iter) && !m_reader_count.compare_exchange_weak(count, iter + 1));
+		}
+
+		return environment_rcu_slot.position;
+	}
+
+	bool 
+	_nimble_environment_rcu::find(
+		__in const std::string &field,
+		__in uint32_t hash,
+		__out std::string &value
+		)
+	{
+		bool result;
+		size_t reader;
+		nimble_environment_map_ptr map = NULL;
+		nimble_environment_map::const_iterator iter;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		reader = _reader();
+		m_reader[reader].epoch.store(m_epoch.load());
+		map = m_current.load();
+
+		iter = ((const nimble_environment_map *) map)->find(field, hash);
+
+		result = (iter != map->end());
+		if(result) {
+			value = iter->second;
+		}
+
+		m_reader[reader].epoch.store(ENV_RCU_EPOCH_IDLE, std::memory_order_release);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+		return result;
+	}
+
+	uint64_t 
+	_nimble_environment_rcu::generation(void)
+	{
+		return m_epoch.load();
+	}
+
+	void 
+	_nimble_environment_rcu::publish(
+		__in const nimble_environment_map &map
+		)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		swap(new nimble_environment_map(map));
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble_environment_rcu::reclaim(void)
+	{
+		uint64_t epoch, oldest = UINT64_MAX;
+		size_t count, iter = 0, position = 0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		count = m_reader_count.load();
+		if(count > ENV_RCU_READERS) {
+			count = ENV_RCU_READERS;
+		}
+
+		for(; iter < count; ++iter) {
+
+			epoch = m_reader[iter].epoch.load();
+			if((epoch != ENV_RCU_EPOCH_IDLE) && (epoch < oldest)) {
+				oldest = epoch;
+			}
+		}
+
+		for(iter = 0; iter < m_retired.size(); ++iter) {
+
+			if(m_retired.at(iter).first <= oldest) {
+				delete m_retired.at(iter).second;
+			} else {
+				m_retired.at(position++) = m_retired.at(iter);
+			}
+		}
+
+		m_retired.resize(position);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ret. %lu", m_retired.size());
+	}
+
+	size_t 
+	_nimble_environment_rcu::remove(
+		__in const std::string &field
+		)
+	{
+		size_t result;
+		nimble_environment_map_ptr map = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		map = new nimble_environment_map(*m_current.load());
+
+		result = map->erase(field);
+		if(result) {
+			swap(map);
+		} else {
+			delete map;
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	size_t 
+	_nimble_environment_rcu::retired(void)
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		reclaim();
+		result = m_retired.size();
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble_environment_rcu::set(
+		__in const std::string &field,
+		__in const std::string &value,
+		__in uint32_t hash
+		)
+	{
+		nimble_environment_map_ptr map = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		map = new nimble_environment_map(*m_current.load());
+		map->set(field, value, hash);
+		swap(map);
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	size_t 
+	_nimble_environment_rcu::size(void)
+	{
+		size_t reader, result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		reader = _reader();
+		m_reader[reader].epoch.store(m_epoch.load());
+		result = m_current.load()->size();
+		m_reader[reader].epoch.store(ENV_RCU_EPOCH_IDLE, std::memory_order_release);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble_environment_rcu::swap(
+		__in nimble_environment_map_ptr map
+		)
+	{
+		nimble_environment_map_ptr previous = NULL;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		previous = m_current.exchange(map);
+		m_retired.push_back(std::pair<uint64_t, nimble_environment_map_ptr>(
+			m_epoch.fetch_add(1) + 1, previous));
+		reclaim();
+
 		TRACE_EXIT(TRACE_VERBOSE);
 	}
 }
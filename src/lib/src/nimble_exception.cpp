@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cctype>
 #include <cstdarg>
 #include "../include/nimble.h"
 
@@ -38,12 +40,245 @@ namespace NIMBLE {
 		((_TYPE_) > NIMBLE_EXCEPTION_EXCEPTION_MAX ? UNKNOWN_EXCEPTION : \
 		CHK_STR(NIMBLE_EXCEPTION_EXCEPTION_STR[_TYPE_]))
 
+	std::map<uint32_t, _nimble_diagnostic::nimble_diagnostic_source> _nimble_diagnostic::m_source_map;
+
+	uint32_t _nimble_diagnostic::m_source_next = (DIAG_SOURCE_INVALID + 1);
+
+	nimble_lock_policy _nimble_diagnostic::m_source_lock;
+
+	_nimble_diagnostic::_nimble_diagnostic(
+		__in_opt uint32_t source,
+		__in_opt size_t offset,
+		__in_opt size_t length,
+		__in_opt uint32_t code
+		) :
+			m_code(code),
+			m_length(length),
+			m_offset(offset),
+			m_source(source)
+	{
+		_source_reference(m_source);
+	}
+
+	_nimble_diagnostic::_nimble_diagnostic(
+		__in const _nimble_diagnostic &other
+		) :
+			m_code(other.m_code),
+			m_length(other.m_length),
+			m_offset(other.m_offset),
+			m_source(other.m_source)
+	{
+		_source_reference(m_source);
+	}
+
+	_nimble_diagnostic::~_nimble_diagnostic(void)
+	{
+		source_release(m_source);
+	}
+
+	_nimble_diagnostic &
+	_nimble_diagnostic::operator=(
+		__in const _nimble_diagnostic &other
+		)
+	{
+		if(this != &other) {
+			_source_reference(other.m_source);
+			source_release(m_source);
+			m_code = other.m_code;
+			m_length = other.m_length;
+			m_offset = other.m_offset;
+			m_source = other.m_source;
+		}
+
+		return *this;
+	}
+
+	void 
+	_nimble_diagnostic::_source_reference(
+		__in uint32_t source
+		)
+	{
+		std::map<uint32_t, nimble_diagnostic_source>::iterator iter;
+
+		if(source != DIAG_SOURCE_INVALID) {
+			SERIALIZE_CALL(m_source_lock);
+
+			iter = m_source_map.find(source);
+			if(iter != m_source_map.end()) {
+				++iter->second.references;
+			}
+		}
+	}
+
+	uint32_t 
+	_nimble_diagnostic::code(void) const
+	{
+		return m_code;
+	}
+
+	bool 
+	_nimble_diagnostic::is_valid(void) const
+	{
+		return (m_source != DIAG_SOURCE_INVALID);
+	}
+
+	size_t 
+	_nimble_diagnostic::length(void) const
+	{
+		return m_length;
+	}
+
+	size_t 
+	_nimble_diagnostic::offset(void) const
+	{
+		return m_offset;
+	}
+
+	std::string 
+	_nimble_diagnostic::render(
+		__in_opt bool verbose
+		) const
+	{
+		char ch;
+		std::stringstream result;
+		size_t column, iter, offset, row = 0, start = 0;
+		std::map<uint32_t, nimble_diagnostic_source>::const_iterator entry;
+
+		SERIALIZE_CALL(m_source_lock);
+
+		entry = m_source_map.find(m_source);
+		if(entry == m_source_map.end()) {
+			return std::string();
+		}
+
+		const std::string &text = entry->second.text;
+		offset = std::min(m_offset, text.size());
+
+		for(iter = 0; iter < offset; ++iter) {
+
+			if(text.at(iter) == CHAR_LINE_FEED) {
+				start = (iter + 1);
+				++row;
+			}
+		}
+
+		column = (offset - start);
+
+		for(iter = start; iter < text.size(); ++iter) {
+
+			ch = text.at(iter);
+			if((ch == CHAR_LINE_FEED) || (ch == CHAR_END_OF_FILE)) {
+				break;
+			}
+
+			result << (std::isprint(ch) ? ch : CHAR_SPACE);
+		}
+
+		result << std::endl;
+		SET_TERM_ATTRIB(result, 1, COL_FORE_GREEN);
+
+		for(iter = 0; iter < column; ++iter) {
+
+			if(iter != (column - 1)) {
+				result << CHAR_FILL;
+			} else {
+				result << CHAR_SPACE;
+			}
+		}
+
+		result << "^";
+
+		for(iter = 1; iter < m_length; ++iter) {
+			result << CHAR_FILL;
+		}
+
+		CLEAR_TERM_ATTRIB(result);
+
+		if(verbose) {
+			result << std::endl << CHAR_TAB;
+			SET_TERM_ATTRIB(result, 1, COL_FORE_YELLOW);
+			result << "(";
+
+			if(!entry->second.path.empty()) {
+				result << CHK_STR(entry->second.path) << ":";
+			}
+
+			result << row << ":" << column << ")";
+			CLEAR_TERM_ATTRIB(result);
+		}
+
+		return CHK_STR(result.str());
+	}
+
+	uint32_t 
+	_nimble_diagnostic::source(void) const
+	{
+		return m_source;
+	}
+
+	uint32_t 
+	_nimble_diagnostic::source_acquire(
+		__in const std::string &text,
+		__in_opt const std::string &path
+		)
+	{
+		uint32_t result;
+
+		SERIALIZE_CALL(m_source_lock);
+
+		result = m_source_next++;
+		if(result == DIAG_SOURCE_INVALID) {
+			result = m_source_next++;
+		}
+
+		nimble_diagnostic_source &entry = m_source_map[result];
+		entry.path = path;
+		entry.references = 1;
+		entry.text = text;
+
+		return result;
+	}
+
+	void 
+	_nimble_diagnostic::source_release(
+		__in uint32_t source
+		)
+	{
+		std::map<uint32_t, nimble_diagnostic_source>::iterator iter;
+
+		if(source != DIAG_SOURCE_INVALID) {
+			SERIALIZE_CALL(m_source_lock);
+
+			iter = m_source_map.find(source);
+			if((iter != m_source_map.end()) && !--iter->second.references) {
+				m_source_map.erase(iter);
+			}
+		}
+	}
+
+	std::string 
+	_nimble_diagnostic::to_string(
+		__in_opt bool verbose
+		) const
+	{
+		std::stringstream result;
+
+		REF_PARAM(verbose);
+
+		result << "src. " << m_source << ", off. " << m_offset << ", len. " << m_length
+			<< ", code. 0x" << VAL_AS_HEX(uint32_t, m_code);
+
+		return CHK_STR(result.str());
+	}
+
 	_nimble_exception::_nimble_exception(
 		__in_opt const std::string &message,
 		__in_opt const std::string &source,
-		__in_opt size_t line
+		__in_opt size_t line,
+		__in_opt const nimble_diagnostic &diagnostic
 		) :
 			std::runtime_error(CHK_STR(message)),
+			m_diagnostic(diagnostic),
 			m_line(line),
 			m_source(source)
 	{
@@ -54,6 +289,7 @@ namespace NIMBLE {
 		__in const _nimble_exception &other
 		) :
 			std::runtime_error(other),
+			m_diagnostic(other.m_diagnostic),
 			m_line(other.m_line),
 			m_source(other.m_source)
 	{
@@ -70,10 +306,9 @@ namespace NIMBLE {
 		__in const _nimble_exception &other
 		)
 	{
-		SERIALIZE_CALL_RECUR(m_lock);
-
 		if(this != &other) {
 			std::runtime_error::operator=(other);
+			m_diagnostic = other.m_diagnostic;
 			m_line = other.m_line;
 			m_source = other.m_source;
 		}
@@ -81,16 +316,16 @@ namespace NIMBLE {
 		return *this;
 	}
 
-	void 
-	_nimble_exception::generate(
+	std::string 
+	_nimble_exception::_generate(
 		__in const std::string &header,
 		__in const std::string &message,
-		__in const std::string &source,
-		__in size_t line,
 		__in const char *format,
-		...
+		__in va_list arguments
 		)
 	{
+		int len;
+		va_list lst;
 		std::string buf;
 		std::stringstream result;
 
@@ -105,10 +340,9 @@ namespace NIMBLE {
 		}
 
 		if(format) {
-			va_list lst;
-			va_start(lst, format);
+			va_copy(lst, arguments);
 
-			int len = vsnprintf(NULL, 0, format, lst);
+			len = vsnprintf(NULL, 0, format, lst);
 			if(len < 0) {
 				buf = NIMBLE_EXCEPTION_EXCEPTION_STRING(
 					NIMBLE_EXCEPTION_EXCEPTION_MALFORMED);
@@ -117,7 +351,7 @@ namespace NIMBLE {
 					NIMBLE_EXCEPTION_EXCEPTION_EMPTY);
 			} else {
 				va_end(lst);
-				va_start(lst, format);
+				va_copy(lst, arguments);
 				buf.resize(++len, '\0');
 
 				len = vsnprintf((char *) &buf[0], len, format, lst);
@@ -142,20 +376,67 @@ namespace NIMBLE {
 			va_end(lst);
 		}
 
-		throw nimble_exception(CHK_STR(result.str()), source, line);
+		return CHK_STR(result.str());
+	}
+
+	const nimble_diagnostic &
+	_nimble_exception::diagnostic(void)
+	{
+		return m_diagnostic;
+	}
+
+	void 
+	_nimble_exception::generate(
+		__in const std::string &header,
+		__in const std::string &message,
+		__in const std::string &source,
+		__in size_t line,
+		__in const char *format,
+		...
+		)
+	{
+		va_list lst;
+		std::string result;
+
+		va_start(lst, format);
+		result = _generate(header, message, format, lst);
+		va_end(lst);
+
+		throw nimble_exception(CHK_STR(result), source, line);
+	}
+
+	void 
+	_nimble_exception::generate(
+		__in const std::string &header,
+		__in const std::string &message,
+		__in const std::string &source,
+		__in size_t line,
+		__in uint32_t code,
+		__in const nimble_diagnostic &diagnostic,
+		__in const char *format,
+		...
+		)
+	{
+		va_list lst;
+		std::string result;
+
+		va_start(lst, format);
+		result = _generate(header, message, format, lst);
+		va_end(lst);
+
+		throw nimble_exception(CHK_STR(result), source, line, nimble_diagnostic(
+			diagnostic.source(), diagnostic.offset(), diagnostic.length(), code));
 	}
 
 	size_t &
 	_nimble_exception::line(void)
 	{
-		SERIALIZE_CALL_RECUR(m_lock);
 		return m_line;
 	}
 
 	std::string &
 	_nimble_exception::source(void)
 	{
-		SERIALIZE_CALL_RECUR(m_lock);
 		return m_source;
 	}
 
@@ -166,10 +447,12 @@ namespace NIMBLE {
 	{
 		std::stringstream result;
 
-		SERIALIZE_CALL_RECUR(m_lock);
-
 		result << what();
 
+		if(m_diagnostic.is_valid()) {
+			result << std::endl << m_diagnostic.render(verbose);
+		}
+
 #ifndef NDEBUG
 		if(verbose) {
 			SET_TERM_ATTRIB(result, 1, COL_FORE_YELLOW);
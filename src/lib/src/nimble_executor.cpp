@@ -36,7 +36,9 @@ namespace NIMBLE {
 		_nimble_executor::_nimble_executor(
 			__in_opt const std::string &input,
 			__in_opt bool is_file
-			)
+			) :
+				m_time_begin(0),
+				m_time_evaluate(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -47,7 +49,9 @@ namespace NIMBLE {
 
 		_nimble_executor::_nimble_executor(
 			__in const _nimble_executor &other
-			)
+			) :
+				m_time_begin(0),
+				m_time_evaluate(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -68,7 +72,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				nimble_executor::set(other);
@@ -82,7 +85,6 @@ namespace NIMBLE {
 		_nimble_executor::clear(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_parser::clear();
 
@@ -95,32 +97,47 @@ namespace NIMBLE {
 			)
 		{
 			int result = 0;
-			nimble_statement stmt;
+			uint64_t begin = 0;
+			nimble_statement *stmt = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_parser::reset();
+			m_timed = (environment && nimble_environment::is_flag_set(environment, ENV_FLAG_TIME));
+			m_time_evaluate = 0;
 
 			while(has_next_statement()) {
-				stmt = statement();
+				stmt = &statement();
 
-				switch(node_token(stmt.front()).type()) {
+				switch(node_token(stmt->front()).type()) {
 					case TOKEN_BEGIN:
 					case TOKEN_END:
 						break;
 					case TOKEN_STATEMENT:
-						evaluate_statement(result, stmt, PAR_INVALID, environment);
+						begin = ((m_timed || PROBE_ACTIVE(statement__end)) ? nimble_probe::now() : 0);
+						m_time_begin = begin;
+						PROBE1(statement__start, m_stmt_position);
+						evaluate_statement(result, *stmt, PAR_INVALID, environment);
+						PROBE3(statement__end, m_stmt_position, result, 
+							PROBE_ELAPSED(statement__end, begin));
+
+						if(m_timed) {
+							m_time_evaluate += (nimble_probe::now() - begin);
+						}
 						break;
 					default:
-						TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+						TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 							NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT),
-							CHK_STR(nimble_parser::statement_exception(0, true)));
-						THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT,
-							"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+							CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+						THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT,
+							nimble_parser::statement_diagnostic());
 				}
 
 				move_next_statement();
+
+				if(m_timed) {
+					time_publish(environment);
+				}
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
@@ -138,44 +155,41 @@ namespace NIMBLE {
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if((result != PAR_INVALID) && (result >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)), result);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					result);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), result);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
+					nimble_parser::statement_diagnostic(), "pos. %lu", result);
 			}
 
 			result = (result != PAR_INVALID) ? result : 0;
 
-			nimble_node nd = node(stmt.at(result));
+			nimble_node &nd = node(stmt.at(result));
 			if(node_token(nd).type() != TOKEN_STATEMENT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
 			if(nd.children().size() != STMT_CHILD_COUNT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
 			result = nd.children().front();
 			if((result != PAR_INVALID) && (result >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_CHILD),
-					CHK_STR(nimble_parser::statement_exception(0, true)), result);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_CHILD,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					result);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), result);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_CHILD,
+					nimble_parser::statement_diagnostic(), "pos. %lu", result);
 			}
 
 			switch(node_token(stmt.at(result)).type()) {
@@ -186,11 +200,11 @@ namespace NIMBLE {
 					result = evaluate_statement_command(status, stmt, result, environment);
 					break;
 				default:
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT),
-						CHK_STR(nimble_parser::statement_exception(0, true)));
-					THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT,
-						"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+						CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+					THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_STATEMENT,
+						nimble_parser::statement_diagnostic());
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -201,44 +215,43 @@ namespace NIMBLE {
 		_nimble_executor::evaluate_statement_argument(
 			__in const nimble_statement &stmt,
 			__in_opt size_t parent,
-			__inout_opt void *environment
+			__inout_opt void *environment,
+			__out_opt uint32_t *hash
 			)
 		{
 			std::string result;
 			size_t par = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if((par != PAR_INVALID) && (par >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)), par);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					par);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), par);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
+					nimble_parser::statement_diagnostic(), "pos. %lu", par);
 			}
 
 			par = (par != PAR_INVALID) ? par : 0;
 
-			nimble_node nd = node(stmt.at(par));
+			nimble_node &nd = node(stmt.at(par));
 			if(node_token(nd).type() != TOKEN_ARGUMENT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_ARGUMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_ARGUMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_ARGUMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
 			if(nd.children().size() != STMT_ARGUMENT_CHILD_COUNT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
-			result = evaluate_statement_literal(stmt, nd.children().front(), environment);
+			result = evaluate_statement_literal(stmt, nd.children().front(), environment, hash);
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result));
 			return result;
@@ -255,45 +268,45 @@ namespace NIMBLE {
 			bool right_arg = false;
 			size_t result = parent;
 			nimble_ptr inst = NULL;
-			std::string field, value;
+			std::string current, field, value;
+			uint32_t field_hash = ENV_HASH_INVALID, value_hash = ENV_HASH_INVALID;
 			
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if((result != PAR_INVALID) && (result >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)), result);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					result);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), result);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
+					nimble_parser::statement_diagnostic(), "pos. %lu", result);
 			}
 
 			result = (result != PAR_INVALID) ? result : 0;
 
-			nimble_node nd = node(stmt.at(result));
+			nimble_node &nd = node(stmt.at(result));
 			if(node_token(nd).type() != TOKEN_ASSIGNMENT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_ASSIGNMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_ASSIGNMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_ASSIGNMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
 			if(nd.children().size() != STMT_ASSIGNMENT_CHILD_COUNT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
-			field = evaluate_statement_argument(stmt, nd.children().at(STMT_ASSIGNMENT_CHILD_LEFT), environment);
+			field = evaluate_statement_argument(stmt, nd.children().at(STMT_ASSIGNMENT_CHILD_LEFT), environment, 
+				&field_hash);
 
 			switch(node_token(stmt.at(nd.children().at(STMT_ASSIGNMENT_CHILD_RIGHT))).type()) {
 				case TOKEN_ARGUMENT:					
 					value = evaluate_statement_argument(stmt, nd.children().at(STMT_ASSIGNMENT_CHILD_RIGHT), 
-							environment);
+							environment, &value_hash);
 					right_arg = true;
 					break;
 				case TOKEN_LITERAL:
@@ -301,18 +314,18 @@ namespace NIMBLE {
 							environment);
 					break;
 				default:
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-						CHK_STR(nimble_parser::statement_exception(0, true)));
-					THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-						"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+						CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+					THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+						nimble_parser::statement_diagnostic());
 			}
 
 			inst = nimble::acquire();
 
 			if(right_arg) {
 
-				if(!inst->environment_contains(value)) {
+				if(!inst->environment_lookup(value, value_hash, current)) {
 					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
 						NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_UNDEFINED_ARGUMENT),
 						CHK_STR(value));
@@ -320,14 +333,16 @@ namespace NIMBLE {
 						"%s", CHK_STR(value));
 				}
 
-				value = inst->environment_find(value)->second;
+				value = current;
 			}
 
-			if(environment) {
+			if(environment && !inst->environment_scope_depth()
+					&& (!inst->environment_lookup(field, field_hash, current) 
+					|| (current != value))) {
 				nimble_environment::add(environment, field, value);
 			}
 
-			inst->environment_set(field, value);
+			inst->environment_set(field, value, field_hash);
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
@@ -341,41 +356,40 @@ namespace NIMBLE {
 			__inout_opt void *environment
 			)
 		{
-			std::string ar;
 			nimble_ptr inst = NULL;
+			std::string ar, value;
 			std::vector<char *> args;
 			size_t iter, result = parent;
 			std::vector<std::string> call;
+			uint32_t hash = ENV_HASH_INVALID;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if((result != PAR_INVALID) && (result >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)), result);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					result);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), result);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
+					nimble_parser::statement_diagnostic(), "pos. %lu", result);
 			}
 
 			result = (result != PAR_INVALID) ? result : 0;
 
-			nimble_node nd = node(stmt.at(result));
+			nimble_node &nd = node(stmt.at(result));
 			if(node_token(nd).type() != TOKEN_CALL) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_CALL),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_CALL,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_CALL,
+					nimble_parser::statement_diagnostic());
 			}
 
 			if(nd.children().size() < STMT_CALL_CHILD_COUNT_MIN) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
 			inst = nimble::acquire();
@@ -384,9 +398,9 @@ namespace NIMBLE {
 
 				if(node_token(stmt.at(nd.children().at(iter))).type() == TOKEN_ARGUMENT) {
 					ar = evaluate_statement_argument(stmt, nd.children().at(iter), 
-						environment);
+						environment, &hash);
 
-					if(!inst->environment_contains(ar)) {
+					if(!inst->environment_lookup(ar, hash, value)) {
 						TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
 							NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_UNDEFINED_ARGUMENT),
 							CHK_STR(ar));
@@ -394,7 +408,7 @@ namespace NIMBLE {
 							"%s", CHK_STR(ar));
 					}
 
-					call.push_back(inst->environment_find(ar)->second);
+					call.push_back(value);
 				} else {
 					call.push_back(evaluate_statement_literal(stmt, nd.children().at(iter), 
 						environment));
@@ -411,7 +425,29 @@ namespace NIMBLE {
 				nimble_environment::flag_set(environment, ENV_FLAG_EXIT);
 			}
 
-			status = execv(call.front().c_str(), &args[0]);
+			if(call.front() == CMD_UNSET) {
+
+				for(iter = 1; iter < call.size(); ++iter) {
+
+					if(environment && !inst->environment_scope_depth()
+							&& inst->environment_contains(call.at(iter))) {
+						nimble_environment::remove(environment, call.at(iter));
+					}
+
+					inst->environment_remove(call.at(iter));
+				}
+
+				status = 0;
+			} else {
+				TRACE_FLUSH();
+
+				if(m_timed) {
+					time_publish(environment, nimble_probe::now());
+				}
+
+				PROBE2(exec, call.front().c_str(), call.size());
+				status = execve(call.front().c_str(), &args[0], inst->environment_export());
+			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
@@ -425,51 +461,48 @@ namespace NIMBLE {
 			__inout_opt void *environment
 			)
 		{
+			nimble_ptr inst = NULL;
+			nimble_node_ptr nd = NULL;
 			size_t iter = 0, result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if((result != PAR_INVALID) && (result >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)), result);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					result);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), result);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
+					nimble_parser::statement_diagnostic(), "pos. %lu", result);
 			}
 
 			result = (result != PAR_INVALID) ? result : 0;
+			nd = &node(stmt.at(result));
+			if(node_token(*nd).type() == TOKEN_COMMAND) {
 
-			nimble_node nd = node(stmt.at(result));
-			if(node_token(nd).type() == TOKEN_COMMAND) {
-
-				if(nd.children().size() < STMT_COMMAND_LIST_CHILD_COUNT) {
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				if(nd->children().size() < STMT_COMMAND_LIST_CHILD_COUNT) {
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-						CHK_STR(nimble_parser::statement_exception(0, true)));
-					THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-						"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+						CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+					THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+						nimble_parser::statement_diagnostic());
 				}
 
-				if(nd.children().front() >= stmt.size()) {
-					TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				if(nd->children().front() >= stmt.size()) {
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 						NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_CHILD),
-						CHK_STR(nimble_parser::statement_exception(0, true)), 
-						nd.children().front());
-					THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_CHILD,
-						"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-						nd.children().front());
+						CHK_STR(nimble_parser::statement_diagnostic().to_string()), nd->children().front());
+					THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_CHILD,
+						nimble_parser::statement_diagnostic(), "pos. %lu", nd->children().front());
 				}
 
-				nd = node(stmt.at(nd.children().front()));
+				nd = &node(stmt.at(nd->children().front()));
 			}
 
-			switch(node_token(nd).type()) {
+			switch(node_token(*nd).type()) {
 				case TOKEN_CALL_LIST:
 
-					for(; iter < nd.children().size(); ++iter) {
-						evaluate_statement_call(status, stmt, nd.children().at(iter), environment);
+					for(; iter < nd->children().size(); ++iter) {
+						evaluate_statement_call(status, stmt, nd->children().at(iter), environment);
 
 						if(status < 0 
 								&& !nimble_environment::is_flag_set(environment, ENV_FLAG_EXIT)) {
@@ -482,14 +515,24 @@ namespace NIMBLE {
 					}
 					break;
 				case TOKEN_COMMAND:
-					evaluate_statement_command(status, stmt, nd.children().front(), environment);
+					inst = nimble::acquire();
+					inst->environment_scope_push();
+
+					try {
+						evaluate_statement_command(status, stmt, nd->children().front(), environment);
+					} catch(...) {
+						inst->environment_scope_pop();
+						throw;
+					}
+
+					inst->environment_scope_pop();
 					break;
 				default:
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_CALL_LIST),
-						CHK_STR(nimble_parser::statement_exception(0, true)));
-					THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_CALL_LIST,
-						"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+						CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+					THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_CALL_LIST,
+						nimble_parser::statement_diagnostic());
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -500,51 +543,58 @@ namespace NIMBLE {
 		_nimble_executor::evaluate_statement_literal(
 			__in const nimble_statement &stmt,
 			__in_opt size_t parent,
-			__inout_opt void *environment
+			__inout_opt void *environment,
+			__out_opt uint32_t *hash
 			)
 		{
 			std::string result;
 			size_t par = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if((par != PAR_INVALID) && (par >= stmt.size())) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %lu\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s, pos. %lu", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)), par);
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
-					"%s, pos. %lu", CHK_STR(nimble_parser::statement_exception(0, true)), 
-					par);
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()), par);
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_INVALID_PARENT,
+					nimble_parser::statement_diagnostic(), "pos. %lu", par);
 			}
 
 			par = (par != PAR_INVALID) ? par : 0;
-			nimble_node nd = node(stmt.at(par));
+			nimble_node &nd = node(stmt.at(par));
 
-			nimble_token tok = node_token(nd);
+			nimble_token &tok = node_token(nd);
 			if(tok.type() != TOKEN_LITERAL) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_LITERAL),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_LITERAL,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_EXPECTING_LITERAL,
+					nimble_parser::statement_diagnostic());
 			}
 
 			if(nd.children().size() != STMT_LITERAL_CHILD_COUNT) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+					nimble_parser::statement_diagnostic());
 			}
 
 			result = tok.text();
 			if(result.empty()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_EXECUTOR_EXCEPTION_STRING(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT),
-					CHK_STR(nimble_parser::statement_exception(0, true)));
-				THROW_NIMBLE_EXECUTOR_EXCEPTION_MESSAGE(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
-					"%s", CHK_STR(nimble_parser::statement_exception(0, true)));
+					CHK_STR(nimble_parser::statement_diagnostic().to_string()));
+				THROW_NIMBLE_EXECUTOR_EXCEPTION_DIAGNOSTIC(NIMBLE_EXECUTOR_EXCEPTION_MALFORMED_STATEMENT,
+					nimble_parser::statement_diagnostic());
+			}
+
+			if(hash) {
+				*hash = tok.hash();
+
+				if(*hash == ENV_HASH_INVALID) {
+					*hash = nimble_environment::hash(result.c_str(), result.size());
+				}
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result));
@@ -558,7 +608,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_parser::set(input, is_file);
 
@@ -571,11 +620,33 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_parser::set(other);
 
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
+
+		void 
+		_nimble_executor::time_publish(
+			__inout void *environment,
+			__in_opt uint64_t exec
+			)
+		{
+			uint64_t evaluate = m_time_evaluate;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(exec) {
+				evaluate += (exec - m_time_begin);
+			}
+
+			nimble_environment::timing_set(environment, ENV_TIME_LEX, m_time_lex);
+			nimble_environment::timing_set(environment, ENV_TIME_PARSE, 
+				(m_time_parse > m_time_lex) ? (m_time_parse - m_time_lex) : 0);
+			nimble_environment::timing_set(environment, ENV_TIME_EVALUATE, evaluate);
+			nimble_environment::timing_set(environment, ENV_TIME_EXEC, exec);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
 	}
 }
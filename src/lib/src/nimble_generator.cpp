@@ -0,0 +1,651 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/nimble.h"
+#include "../include/nimble_generator_type.h"
+
+namespace NIMBLE {
+
+	namespace LANGUAGE {
+
+		#define GEN_CHANCE_MAX 100
+		#define GEN_FLUSH_LEN 0x10000
+		#define GEN_NAME_COUNT 64
+		#define GEN_NAME_PREFIX "VAR"
+
+		static const uint8_t GEN_MIX_DEFAULT[] = {
+			30, 25, 20, 5, 50, 15, 20, 15, 5, 20,
+			};
+
+		static const std::string GEN_MIX_STR[] = {
+			"argument", "assignment", "call_list", "comment", "literal", "nest", "pipe", 
+			"redirect", "seperator", "string",
+			};
+
+		#define GEN_MIX_STRING(_TYPE_) \
+			((_TYPE_) > GEN_MIX_MAX ? UNKNOWN : \
+			CHK_STR(GEN_MIX_STR[_TYPE_]))
+
+		static const std::string GEN_COMMAND_STR[] = {
+			"/bin/echo", "/bin/cat", "/usr/bin/env", "ls", "grep", "sort", "wc", "./run.sh",
+			};
+
+		#define GEN_COMMAND_COUNT (sizeof(GEN_COMMAND_STR) / sizeof(GEN_COMMAND_STR[0]))
+
+		static const std::string GEN_FRAGMENT_STR[] = {
+			"hello", "world", "$HOME", "a;b", "x|y", "(nested)", "k=v", "2>&1", "#tag", 
+			"tab\tstop", ">&!", "<in", "&",
+			};
+
+		#define GEN_FRAGMENT_COUNT (sizeof(GEN_FRAGMENT_STR) / sizeof(GEN_FRAGMENT_STR[0]))
+
+		static const nimble_subtok_t GEN_REDIRECT_OUT[] = {
+			SYMBOL_REDIRECT_OUT, SYMBOL_REDIRECT_OUT_APPEND, SYMBOL_REDIRECT_OUT_ERR,
+			SYMBOL_REDIRECT_OUT_ERR_APPEND, SYMBOL_REDIRECT_OUT_ERR_OVERWRITE, 
+			SYMBOL_REDIRECT_OUT_OVERWRITE,
+			};
+
+		#define GEN_REDIRECT_OUT_COUNT (sizeof(GEN_REDIRECT_OUT) / sizeof(GEN_REDIRECT_OUT[0]))
+
+		_nimble_generator::_nimble_generator(
+			__in_opt uint64_t seed,
+			__in_opt size_t depth,
+			__in_opt size_t words
+			) :
+				m_bytes(0),
+				m_depth(depth),
+				m_merged(0),
+				m_nested(0),
+				m_open(false),
+				m_seed(seed),
+				m_state(seed),
+				m_statements(0),
+				m_tokens(0),
+				m_words(words ? words : 1)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			memcpy(m_mix, GEN_MIX_DEFAULT, sizeof(m_mix));
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		_nimble_generator::_nimble_generator(
+			__in const _nimble_generator &other
+			) :
+				m_buffer(other.m_buffer),
+				m_bytes(other.m_bytes),
+				m_depth(other.m_depth),
+				m_merged(other.m_merged),
+				m_nested(other.m_nested),
+				m_open(other.m_open),
+				m_seed(other.m_seed),
+				m_state(other.m_state),
+				m_statements(other.m_statements),
+				m_tokens(other.m_tokens),
+				m_words(other.m_words)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			memcpy(m_mix, other.m_mix, sizeof(m_mix));
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		_nimble_generator::~_nimble_generator(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		_nimble_generator &
+		_nimble_generator::operator=(
+			__in const _nimble_generator &other
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+				m_buffer = other.m_buffer;
+				m_bytes = other.m_bytes;
+				m_depth = other.m_depth;
+				m_merged = other.m_merged;
+				memcpy(m_mix, other.m_mix, sizeof(m_mix));
+				m_nested = other.m_nested;
+				m_open = other.m_open;
+				m_seed = other.m_seed;
+				m_state = other.m_state;
+				m_statements = other.m_statements;
+				m_tokens = other.m_tokens;
+				m_words = other.m_words;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
+		size_t 
+		_nimble_generator::bytes(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_bytes);
+			return m_bytes;
+		}
+
+		bool 
+		_nimble_generator::chance(
+			__in uint8_t type
+			)
+		{
+			bool result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = ((next() % GEN_CHANCE_MAX) < mix(type));
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
+			return result;
+		}
+
+		void 
+		_nimble_generator::emit(
+			__in const std::string &text,
+			__in_opt size_t tokens
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!m_buffer.empty() && (m_buffer.back() != CHAR_LINE_FEED)) {
+				m_buffer += CHAR_SPACE;
+			}
+
+			m_buffer += text;
+			m_tokens += tokens;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_argument(void)
+		{
+			std::string name;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			name = (nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_MODIFIER) 
+				+ GEN_NAME_PREFIX + std::to_string(next() % GEN_NAME_COUNT));
+			emit(name, 2);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_assignment(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			emit_argument();
+			emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_ASSIGNMENT));
+			emit_word();
+			m_open = false;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_call(void)
+		{
+			size_t count, iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if((next() % (mix(GEN_MIX_LITERAL) + mix(GEN_MIX_STRING) + 1)) 
+					< mix(GEN_MIX_STRING)) {
+				emit_string();
+			} else {
+				emit(GEN_COMMAND_STR[next() % GEN_COMMAND_COUNT]);
+			}
+
+			count = (next() % m_words);
+
+			for(iter = 0; iter < count; ++iter) {
+				emit_word();
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_call_list(void)
+		{
+			size_t iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			emit_call();
+
+			for(iter = 0; (iter < GEN_REPEAT_MAX) && chance(GEN_MIX_CALL_LIST); ++iter) {
+				emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_SEPERATOR));
+				emit_call();
+			}
+
+			m_open = true;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_command_0(
+			__in size_t depth,
+			__in_opt uint8_t start
+			)
+		{
+			size_t iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			emit_command_1(depth, start);
+
+			for(iter = 0; (iter < GEN_REPEAT_MAX) && chance(GEN_MIX_REDIRECT) 
+					&& chance(GEN_MIX_REDIRECT); ++iter) {
+				emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_REDIRECT_IN));
+				emit_command_1(depth);
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_command_1(
+			__in size_t depth,
+			__in_opt uint8_t start
+			)
+		{
+			size_t iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			emit_command_2(depth, start);
+
+			for(iter = 0; (iter < GEN_REPEAT_MAX) && chance(GEN_MIX_REDIRECT); ++iter) {
+				emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, 
+					GEN_REDIRECT_OUT[next() % GEN_REDIRECT_OUT_COUNT]));
+				emit_command_2(depth);
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_command_2(
+			__in size_t depth,
+			__in_opt uint8_t start
+			)
+		{
+			size_t iter;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			emit_command_3(depth, start);
+
+			for(iter = 0; (iter < GEN_REPEAT_MAX) && chance(GEN_MIX_PIPE); ++iter) {
+				emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_PIPE));
+				emit_command_3(depth);
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_command_3(
+			__in size_t depth,
+			__in_opt uint8_t start
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if((start == GEN_START_ANY) && (depth < m_depth) 
+					&& (m_nested < (m_depth * GEN_REPEAT_MAX)) && chance(GEN_MIX_NEST)) {
+				start = GEN_START_NEST;
+			}
+
+			switch(start) {
+				case GEN_START_CALL:
+					emit_call_list();
+					break;
+				case GEN_START_NEST:
+					emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, 
+						SYMBOL_OPEN_PARENTHESIS));
+					++m_nested;
+					emit_command_0(depth + 1);
+					emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, 
+						SYMBOL_CLOSE_PARENTHESIS));
+					m_open = false;
+					break;
+				default:
+
+					if((next() % (GEN_CHANCE_MAX * 4)) < mix(GEN_MIX_ARGUMENT)) {
+						emit_argument();
+						m_open = false;
+					} else {
+						emit_call_list();
+					}
+					break;
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_literal(void)
+		{
+			std::string result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			switch(next() % 4) {
+				case 0:
+					result = "-";
+					result += (char) ('a' + (next() % 26));
+					break;
+				case 1:
+					result = ("file" + std::to_string(next() % 1000) + ".txt");
+					break;
+				case 2:
+					result = std::to_string(next() % 100000);
+					break;
+				default:
+					result = ("/usr/local/share/word" + std::to_string(next() % 100));
+					break;
+			}
+
+			emit(result);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_statement(void)
+		{
+			bool assignment;
+			uint8_t start = GEN_START_CALL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			assignment = chance(GEN_MIX_ASSIGNMENT);
+			if(!assignment && m_depth && chance(GEN_MIX_NEST)) {
+				start = GEN_START_NEST;
+			}
+
+			if(m_open && !assignment && (start == GEN_START_CALL) 
+					&& (m_merged >= GEN_REPEAT_MAX)) {
+
+				if(m_depth) {
+					start = GEN_START_NEST;
+				} else {
+					assignment = true;
+				}
+			}
+
+			m_nested = 0;
+
+			if(m_open && !assignment && (start == GEN_START_CALL)) {
+				emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_SEPERATOR));
+				emit_command_0(0, start);
+				++m_merged;
+			} else {
+
+				if(chance(GEN_MIX_COMMENT)) {
+					m_buffer += CHAR_COMMENT;
+					m_buffer += (" statement " + std::to_string(m_statements) + " seed " 
+						+ std::to_string(m_seed));
+					m_buffer += CHAR_LINE_FEED;
+				}
+
+				if(m_open || chance(GEN_MIX_SEPERATOR)) {
+					emit(nimble_language::subtype_as_string(TOKEN_SYMBOL, SYMBOL_SEPERATOR));
+				}
+
+				if(assignment) {
+					emit_assignment();
+				} else {
+					emit_command_0(0, start);
+				}
+
+				m_merged = 0;
+				++m_statements;
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_string(void)
+		{
+			size_t count, iter;
+			std::string result(1, CHAR_LITERAL_STRING_DELIMITER);
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			count = ((next() % GEN_REPEAT_MAX) + 1);
+
+			for(iter = 0; iter < count; ++iter) {
+
+				if(iter) {
+					result += CHAR_SPACE;
+				}
+
+				result += GEN_FRAGMENT_STR[next() % GEN_FRAGMENT_COUNT];
+			}
+
+			result += CHAR_LITERAL_STRING_DELIMITER;
+			emit(result);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		void 
+		_nimble_generator::emit_word(void)
+		{
+			uint64_t value;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			value = (next() % (mix(GEN_MIX_ARGUMENT) + mix(GEN_MIX_LITERAL) 
+				+ mix(GEN_MIX_STRING) + 1));
+
+			if(value < mix(GEN_MIX_ARGUMENT)) {
+				emit_argument();
+			} else if(value < (mix(GEN_MIX_ARGUMENT) + mix(GEN_MIX_STRING))) {
+				emit_string();
+			} else {
+				emit_literal();
+			}
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		size_t 
+		_nimble_generator::generate(
+			__inout std::ostream &stream,
+			__in size_t bytes,
+			__in_opt size_t statements
+			)
+		{
+			size_t begin, length, limit, result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(!stream.good()) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s", NIMBLE_GENERATOR_EXCEPTION_STRING(
+					NIMBLE_GENERATOR_EXCEPTION_INVALID_STREAM));
+				THROW_NIMBLE_GENERATOR_EXCEPTION(NIMBLE_GENERATOR_EXCEPTION_INVALID_STREAM);
+			}
+
+			begin = m_statements;
+			limit = (m_bytes + bytes);
+
+			while((bytes || statements) && (!bytes || (m_bytes < limit))
+					&& (!statements || ((m_statements - begin) < statements))) {
+				length = m_buffer.size();
+				emit_statement();
+				m_buffer += CHAR_LINE_FEED;
+				m_bytes += (m_buffer.size() - length);
+
+				if(m_buffer.size() >= GEN_FLUSH_LEN) {
+					stream.write(m_buffer.c_str(), m_buffer.size());
+					m_buffer.clear();
+				}
+			}
+
+			if(!m_buffer.empty()) {
+				stream.write(m_buffer.c_str(), m_buffer.size());
+				m_buffer.clear();
+			}
+
+			result = (m_statements - begin);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+			return result;
+		}
+
+		std::string 
+		_nimble_generator::generate(
+			__in size_t statements
+			)
+		{
+			std::stringstream result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			generate(result, 0, statements);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+			return result.str();
+		}
+
+		uint8_t &
+		_nimble_generator::mix(
+			__in uint8_t type
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(type > GEN_MIX_MAX) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, type. %x", NIMBLE_GENERATOR_EXCEPTION_STRING(
+					NIMBLE_GENERATOR_EXCEPTION_INVALID_MIX), type);
+				THROW_NIMBLE_GENERATOR_EXCEPTION_MESSAGE(NIMBLE_GENERATOR_EXCEPTION_INVALID_MIX,
+					"type. %x", type);
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %u", m_mix[type]);
+			return m_mix[type];
+		}
+
+		std::string 
+		_nimble_generator::mix_as_string(
+			__in uint8_t type
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+			return GEN_MIX_STRING(type);
+		}
+
+		uint64_t 
+		_nimble_generator::next(void)
+		{
+			uint64_t result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			m_state += 0x9e3779b97f4a7c15ULL;
+			result = m_state;
+			result = ((result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ULL);
+			result = ((result ^ (result >> 27)) * 0x94d049bb133111ebULL);
+			result ^= (result >> 31);
+
+			TRACE_EXIT(TRACE_VERBOSE);
+			return result;
+		}
+
+		void 
+		_nimble_generator::reset(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			m_buffer.clear();
+			m_bytes = 0;
+			m_merged = 0;
+			m_nested = 0;
+			m_open = false;
+			m_state = m_seed;
+			m_statements = 0;
+			m_tokens = 0;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
+		size_t 
+		_nimble_generator::statements(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_statements);
+			return m_statements;
+		}
+
+		std::string 
+		_nimble_generator::to_string(
+			__in_opt bool verbose
+			)
+		{
+			uint8_t iter;
+			std::stringstream result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result << "{\"seed\":" << m_seed << ",\"bytes\":" << m_bytes << ",\"tokens\":" 
+				<< m_tokens << ",\"statements\":" << m_statements;
+
+			if(verbose) {
+				result << ",\"depth\":" << m_depth << ",\"words\":" << m_words << ",\"mix\":{";
+
+				for(iter = 0; iter <= GEN_MIX_MAX; ++iter) {
+					result << (iter ? "," : "") << "\"" << GEN_MIX_STRING(iter) << "\":" 
+						<< (int) m_mix[iter];
+				}
+
+				result << "}";
+			}
+
+			result << "}";
+
+			TRACE_EXIT(TRACE_VERBOSE);
+			return result.str();
+		}
+
+		size_t 
+		_nimble_generator::tokens(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_tokens);
+			return m_tokens;
+		}
+	}
+}
@@ -337,7 +337,6 @@ namespace NIMBLE {
 		)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 
 		if(this != &other) {
 			m_column = other.m_column;
@@ -375,7 +374,6 @@ namespace NIMBLE {
 	_nimble_token_meta::column(void)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_column);
 		return m_column;
 	}
@@ -384,7 +382,6 @@ namespace NIMBLE {
 	_nimble_token_meta::column_offset(void)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_column_offset);
 		return m_column_offset;
 	}
@@ -393,7 +390,6 @@ namespace NIMBLE {
 	_nimble_token_meta::line(void)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_line));
 		return m_line;
 	}
@@ -402,7 +398,6 @@ namespace NIMBLE {
 	_nimble_token_meta::path(void)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_path));
 		return m_path;
 	}
@@ -411,7 +406,6 @@ namespace NIMBLE {
 	_nimble_token_meta::row(void)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_row);
 		return m_row;
 	}
@@ -420,7 +414,6 @@ namespace NIMBLE {
 	_nimble_token_meta::row_offset(void)
 	{
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_row_offset);
 		return m_row_offset;
 	}
@@ -434,7 +427,6 @@ namespace NIMBLE {
 		std::string result;
 
 		TRACE_ENTRY(TRACE_VERBOSE);
-		SERIALIZE_CALL_RECUR(m_lock);
 
 		result = nimble_token_meta::as_string(*this, tabs, verbose);;
 
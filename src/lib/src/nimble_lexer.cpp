@@ -46,7 +46,8 @@ namespace NIMBLE {
 			) :
 				m_char_column(0),
 				m_char_position(0),
-				m_char_row(0)
+				m_char_row(0),
+				m_diagnostic_source(DIAG_SOURCE_INVALID)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -62,6 +63,7 @@ namespace NIMBLE {
 				m_char_line(other.m_char_line),
 				m_char_position(other.m_char_position),
 				m_char_row(other.m_char_row),
+				m_diagnostic_source(DIAG_SOURCE_INVALID),
 				m_path(other.m_path),
 				m_source(other.m_source)
 		{
@@ -72,6 +74,9 @@ namespace NIMBLE {
 		_nimble_lexer_base::~_nimble_lexer_base(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
+
+			nimble_diagnostic::source_release(m_diagnostic_source);
+
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
@@ -81,13 +86,14 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				m_char_column = other.m_char_column;
 				m_char_line = other.m_char_line;
 				m_char_position = other.m_char_position;
 				m_char_row = other.m_char_row;
+				nimble_diagnostic::source_release(m_diagnostic_source);
+				m_diagnostic_source = DIAG_SOURCE_INVALID;
 				m_path = other.m_path;
 				m_source = other.m_source;
 			}
@@ -102,7 +108,6 @@ namespace NIMBLE {
 			char result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(m_char_position >= m_source.size()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -165,7 +170,6 @@ namespace NIMBLE {
 			char_cls_t result = CHAR_CLASS_SYMBOL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			ch = character();
 			if(ch == CHAR_END_OF_FILE) {
@@ -187,11 +191,23 @@ namespace NIMBLE {
 		_nimble_lexer_base::character_column(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_char_column);
 			return m_char_column;
 		}
 
+		nimble_diagnostic 
+		_nimble_lexer_base::character_diagnostic(void)
+		{
+			nimble_diagnostic result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = nimble_diagnostic(diagnostic_source(), m_char_position, 1);
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.to_string(true)));
+			return result;
+		}
+
 		std::string 
 		_nimble_lexer_base::character_exception(
 			__in_opt size_t tabs,
@@ -201,7 +217,6 @@ namespace NIMBLE {
 			std::string result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = character_exception(CHK_STR(character_line()), m_path, 
 					m_char_column, m_char_column, m_char_row, m_char_row, 
@@ -318,7 +333,6 @@ namespace NIMBLE {
 			std::string result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = find_line(m_char_row)->second.second;
 
@@ -330,7 +344,6 @@ namespace NIMBLE {
 		_nimble_lexer_base::character_position(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_char_position);
 			return m_char_position;
 		}
@@ -339,7 +352,6 @@ namespace NIMBLE {
 		_nimble_lexer_base::character_row(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_char_row);
 			return m_char_row;
 		}
@@ -363,12 +375,13 @@ namespace NIMBLE {
 		_nimble_lexer_base::clear(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			m_char_column = 0;
 			m_char_line.clear();
 			m_char_position = 0;
 			m_char_row = 0;
+			nimble_diagnostic::source_release(m_diagnostic_source);
+			m_diagnostic_source = DIAG_SOURCE_INVALID;
 			m_path.clear();
 			m_source.clear();
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Lexer base cleared");
@@ -376,13 +389,25 @@ namespace NIMBLE {
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
+		uint32_t 
+		_nimble_lexer_base::diagnostic_source(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(m_diagnostic_source == DIAG_SOURCE_INVALID) {
+				m_diagnostic_source = nimble_diagnostic::source_acquire(m_source, m_path);
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %u", m_diagnostic_source);
+			return m_diagnostic_source;
+		}
+
 		size_t 
 		_nimble_lexer_base::discover(void)
 		{
 			size_t result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_lexer_base::reset();
 			result = nimble_lexer_base::size();
@@ -401,7 +426,6 @@ namespace NIMBLE {
 			std::map<size_t, std::pair<size_t, std::string>>::iterator result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = m_char_line.find(row);
 			if(result == m_char_line.end()) {
@@ -412,7 +436,7 @@ namespace NIMBLE {
 					"%lu", row);
 			}
 
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &*result);
 			return result;
 		}
 
@@ -422,7 +446,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = ((m_char_position < m_source.size()) 
 				&& (character_class() != CHAR_CLASS_END));
@@ -437,7 +460,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = !m_path.empty();
 
@@ -451,7 +473,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_char_position > 0);
 
@@ -467,7 +488,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = is_newline(m_char_position, true, length);
 
@@ -487,7 +507,6 @@ namespace NIMBLE {
 			bool result = false, valid;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			valid = (forward ? (position < m_source.size()) : true);
 			if(valid) {
@@ -535,7 +554,6 @@ namespace NIMBLE {
 			std::string line;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!has_next_character()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -601,7 +619,6 @@ namespace NIMBLE {
 			size_t len;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!has_previous_character()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -639,7 +656,6 @@ namespace NIMBLE {
 		_nimble_lexer_base::path(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_path));
 			return m_path;
 		}
@@ -648,7 +664,6 @@ namespace NIMBLE {
 		_nimble_lexer_base::reset(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			m_char_column = 0;
 			m_char_position = 0;
@@ -670,7 +685,6 @@ namespace NIMBLE {
 			std::string line;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_lexer_base::clear();
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Lexer base set");
@@ -731,7 +745,6 @@ namespace NIMBLE {
 			size_t result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_source.size() - SENTINEL_LEXER_BASE);
 
@@ -743,7 +756,6 @@ namespace NIMBLE {
 		_nimble_lexer_base::source(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_source));
 			return CHK_STR(m_source);
 		}
@@ -759,7 +771,6 @@ namespace NIMBLE {
 			std::string::iterator iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(verbose) {
 				result << "(" << m_char_position << "/" << size() << ") ";
@@ -782,14 +793,21 @@ namespace NIMBLE {
 			return CHK_STR(result.str());
 		}
 
+		nimble_stats _nimble_lexer::m_tok_stats;
+
 		_nimble_lexer::_nimble_lexer(
 			__in_opt const std::string &input,
 			__in_opt bool is_file
 			) :
+				m_probe_begin(0),
+				m_time_lex(0),
+				m_timed(false),
+				m_tok_bytes(0),
 				m_tok_position(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
+			m_tok_stats.allocate();
 			nimble_lexer::set(input, is_file);
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -797,10 +815,15 @@ namespace NIMBLE {
 
 		_nimble_lexer::_nimble_lexer(
 			__in const _nimble_lexer &other
-			)
+			) :
+				m_probe_begin(0),
+				m_time_lex(0),
+				m_timed(false),
+				m_tok_bytes(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
+			m_tok_stats.allocate();
 			nimble_lexer::set(other);
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -811,6 +834,8 @@ namespace NIMBLE {
 			TRACE_ENTRY(TRACE_VERBOSE);
 
 			nimble_lexer::clear();
+			m_tok_stats.resize(m_tok_bytes, 0);
+			m_tok_stats.release();
 
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
@@ -821,7 +846,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				nimble_lexer::set(other);
@@ -862,7 +886,6 @@ namespace NIMBLE {
 			std::vector<nimble_uid>::iterator iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_lexer_base::reset();
 			fact = nimble_lexer::acquire_token();
@@ -882,6 +905,7 @@ namespace NIMBLE {
 
 			m_tok_list.clear();
 			m_tok_position = 0;
+			nimble_lexer::update_token_stats();
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Lexer cleared");
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -893,7 +917,6 @@ namespace NIMBLE {
 			size_t result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			while(has_next_token()) {
 				move_next_token();
@@ -914,7 +937,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			tok.column() = character_column();
 			tok.path() = path();
@@ -932,9 +954,15 @@ namespace NIMBLE {
 				default:
 					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_LEXER_EXCEPTION_STRING(NIMBLE_LEXER_EXCEPTION_EXPECTING_COMMAND),
-						CHK_STR(token_exception(0, true)));
-					THROW_NIMBLE_LEXER_EXCEPTION_MESSAGE(NIMBLE_LEXER_EXCEPTION_EXPECTING_COMMAND,
-						"%s", CHK_STR(token_exception(0, true)));
+						CHK_STR(token_diagnostic().to_string()));
+					THROW_NIMBLE_LEXER_EXCEPTION_DIAGNOSTIC(NIMBLE_LEXER_EXCEPTION_EXPECTING_COMMAND,
+						token_diagnostic());
+			}
+
+			if((tok.type() == TOKEN_LITERAL)
+					&& (token().type() == TOKEN_SYMBOL)
+					&& (token().subtype() == SYMBOL_MODIFIER)) {
+				tok.hash() = nimble_environment::hash(tok.text().c_str(), tok.text().size());
 			}
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -950,7 +978,6 @@ namespace NIMBLE {
 			bool delim = false;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			ch = character();
 			switch(character_class()) {
@@ -990,19 +1017,19 @@ namespace NIMBLE {
 					}
 
 					if(delim) {
-						TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+						TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 							NIMBLE_LEXER_EXCEPTION_STRING(NIMBLE_LEXER_EXCEPTION_UNTERMINATED_LITERAL),
-							CHK_STR(character_exception(0, true)));
-						THROW_NIMBLE_LEXER_EXCEPTION_MESSAGE(NIMBLE_LEXER_EXCEPTION_UNTERMINATED_LITERAL,
-							"\n%s", CHK_STR(character_exception(0, true)));
+							CHK_STR(character_diagnostic().to_string()));
+						THROW_NIMBLE_LEXER_EXCEPTION_DIAGNOSTIC(NIMBLE_LEXER_EXCEPTION_UNTERMINATED_LITERAL,
+							character_diagnostic());
 					}
 					break;
 				default:
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_LEXER_EXCEPTION_STRING(NIMBLE_LEXER_EXCEPTION_EXPECTING_LITERAL),
-						CHK_STR(character_exception(0, true)));
-					THROW_NIMBLE_LEXER_EXCEPTION_MESSAGE(NIMBLE_LEXER_EXCEPTION_EXPECTING_LITERAL,
-						"\n%s", CHK_STR(character_exception(0, true)));
+						CHK_STR(character_diagnostic().to_string()));
+					THROW_NIMBLE_LEXER_EXCEPTION_DIAGNOSTIC(NIMBLE_LEXER_EXCEPTION_EXPECTING_LITERAL,
+						character_diagnostic());
 			}
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -1016,14 +1043,13 @@ namespace NIMBLE {
 			char ch;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(character_class() != CHAR_CLASS_SYMBOL) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_LEXER_EXCEPTION_STRING(NIMBLE_LEXER_EXCEPTION_EXPECTING_SYMBOL),
-					CHK_STR(character_exception(0, true)));
-				THROW_NIMBLE_LEXER_EXCEPTION_MESSAGE(NIMBLE_LEXER_EXCEPTION_EXPECTING_SYMBOL,
-					"\n%s", CHK_STR(character_exception(0, true)));
+					CHK_STR(character_diagnostic().to_string()));
+				THROW_NIMBLE_LEXER_EXCEPTION_DIAGNOSTIC(NIMBLE_LEXER_EXCEPTION_EXPECTING_SYMBOL,
+					character_diagnostic());
 			}
 
 			ch = character();
@@ -1068,7 +1094,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = ((m_tok_position < m_tok_list.size()) 
 				&& (token().type() != TOKEN_END));
@@ -1083,7 +1108,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_tok_position > 0);
 
@@ -1102,7 +1126,6 @@ namespace NIMBLE {
 			nimble_token_factory_ptr fact = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			fact = acquire_token();
 			uid = fact->generate();
@@ -1132,6 +1155,8 @@ namespace NIMBLE {
 				m_tok_list.push_back(uid);
 			}
 
+			nimble_lexer::update_token_stats();
+
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", 
 				CHK_STR(nimble_token::as_string(tok, true)));
 			return tok;	
@@ -1140,8 +1165,9 @@ namespace NIMBLE {
 		nimble_token &
 		_nimble_lexer::move_next_token(void)
 		{
+			uint64_t begin = 0;
+
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!has_next_token()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -1155,7 +1181,22 @@ namespace NIMBLE {
 
 			if(has_next_character() 
 					&& (m_tok_position <= (m_tok_list.size() - SENTINEL_LEXER))) {
+
+				if(m_timed) {
+					begin = nimble_probe::now();
+				}
+
 				enumerate_token(insert_token(TOK_INVALID, TOKSUB_INVALID, m_tok_position + 1));
+
+				if(m_timed) {
+					m_time_lex += (nimble_probe::now() - begin);
+				}
+			}
+
+			if(m_probe_begin && !has_next_character()) {
+				PROBE2(lex__end, m_tok_list.size() - SENTINEL_LEXER, 
+					PROBE_ELAPSED(lex__end, m_probe_begin));
+				m_probe_begin = 0;
 			}
 
 			++m_tok_position;
@@ -1172,7 +1213,6 @@ namespace NIMBLE {
 		_nimble_lexer::move_previous_token(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!has_previous_token()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -1196,7 +1236,6 @@ namespace NIMBLE {
 		_nimble_lexer::reset(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			m_tok_position = 0;
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Lexer reset");
@@ -1211,13 +1250,14 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_lexer::clear();
 			nimble_lexer_base::set(input, is_file);
 			insert_token(TOKEN_BEGIN, TOKSUB_INVALID, 0);
 			insert_token(TOKEN_END, TOKSUB_INVALID, 1);
 			nimble_lexer::reset();
+			PROBE1(lex__start, m_source.size());
+			m_probe_begin = PROBE_TIME(lex__end);
 			TRACE_MESSAGE(TRACE_INFORMATION, "Lexer set input -> \'%s\', file -> 0x%x", 
 				CHK_STR(input), is_file);
 
@@ -1233,7 +1273,6 @@ namespace NIMBLE {
 			std::vector<nimble_uid>::iterator iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_lexer::clear();
 			nimble_lexer_base::operator=(other);
@@ -1254,6 +1293,8 @@ namespace NIMBLE {
 				}
 			} catch(...) { }
 
+			nimble_lexer::update_token_stats();
+
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
@@ -1263,7 +1304,6 @@ namespace NIMBLE {
 			size_t result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (!m_tok_list.empty() ? (m_tok_list.size() - SENTINEL_LEXER) : 0);
 
@@ -1277,7 +1317,6 @@ namespace NIMBLE {
 			size_t len;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			while(has_next_character()) {
 
@@ -1324,7 +1363,6 @@ namespace NIMBLE {
 			std::stringstream result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(verbose) {
 				result << "(" << m_tok_position << "/" << (m_tok_list.size() - 1) << ") ";
@@ -1348,7 +1386,6 @@ namespace NIMBLE {
 		_nimble_lexer::token(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(m_tok_position >= m_tok_list.size()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -1417,6 +1454,22 @@ namespace NIMBLE {
 			return tok;
 		}
 
+		nimble_diagnostic 
+		_nimble_lexer::token_diagnostic(void)
+		{
+			nimble_diagnostic result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			nimble_token &tok = token();
+			result = nimble_diagnostic(diagnostic_source(), (tok.type() == TOKEN_END) 
+				? (m_source.size() - SENTINEL_LEXER_BASE) : tok.position(), 
+				std::max(tok.text().size(), (size_t) 1));
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.to_string(true)));
+			return result;
+		}
+
 		std::string 
 		_nimble_lexer::token_exception(
 			__in_opt size_t tabs,
@@ -1428,7 +1481,6 @@ namespace NIMBLE {
 			std::stringstream result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			tok = token();
 			meta = tok.meta();
@@ -1438,5 +1490,27 @@ namespace NIMBLE {
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
 			return CHK_STR(result.str());
 		}
+
+		const nimble_stats &
+		_nimble_lexer::token_stats(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &m_tok_stats);
+			return m_tok_stats;
+		}
+
+		void 
+		_nimble_lexer::update_token_stats(void)
+		{
+			size_t bytes;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			bytes = (m_source.capacity() + (m_tok_list.capacity() * sizeof(nimble_uid)));
+			m_tok_stats.resize(m_tok_bytes, bytes);
+			m_tok_bytes = bytes;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
 	}
 }
@@ -26,9 +26,10 @@ namespace NIMBLE {
 
 		_nimble_node::_nimble_node(
 			__in_opt const nimble_uid &token,
-			__in_opt size_t parent
+			__in_opt nimble_node_index_t parent
 			) :
-				m_parent(parent)
+				m_parent(parent),
+				m_token(UID_INVALID)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -42,7 +43,8 @@ namespace NIMBLE {
 			) :
 				nimble_uid_class(other),
 				m_children(other.m_children),
-				m_parent(other.m_parent)
+				m_parent(other.m_parent),
+				m_token(UID_INVALID)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -51,6 +53,22 @@ namespace NIMBLE {
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
+		_nimble_node::_nimble_node(
+			__in _nimble_node &&other
+			) :
+				nimble_uid_class(std::move(other)),
+				m_children(std::move(other.m_children)),
+				m_parent(other.m_parent),
+				m_token(other.m_token)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			other.m_parent = PAR_INVALID;
+			other.m_token = UID_INVALID;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
 		_nimble_node::~_nimble_node(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
@@ -66,7 +84,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				nimble_uid_class::operator=(other);
@@ -79,6 +96,27 @@ namespace NIMBLE {
 			return *this;
 		}
 
+		_nimble_node &
+		_nimble_node::operator=(
+			__in _nimble_node &&other
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+				nimble_node::clear();
+				nimble_uid_class::operator=(std::move(other));
+				m_children = std::move(other.m_children);
+				m_parent = other.m_parent;
+				m_token = other.m_token;
+				other.m_parent = PAR_INVALID;
+				other.m_token = UID_INVALID;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
 		nimble_token_factory_ptr 
 		_nimble_node::acquire_token(void)
 		{
@@ -151,11 +189,10 @@ namespace NIMBLE {
 			return CHK_STR(result.str());
 		}
 
-		std::vector<size_t> &
+		nimble_node_children &
 		_nimble_node::children(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &m_children);
 			return m_children;
 		}
@@ -166,7 +203,6 @@ namespace NIMBLE {
 			nimble_token_factory_ptr fact = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			m_children.clear();
 			m_parent = PAR_INVALID;
@@ -191,7 +227,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = m_children.empty();
 
@@ -205,7 +240,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_parent == PAR_INVALID);
 
@@ -213,12 +247,11 @@ namespace NIMBLE {
 			return result;
 		}
 
-		size_t &
+		nimble_node_index_t &
 		_nimble_node::parent(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_parent);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %u", m_parent);
 			return m_parent;
 		}
 
@@ -230,7 +263,6 @@ namespace NIMBLE {
 			nimble_token_factory_ptr fact = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			fact = nimble_node::acquire_token();
 
@@ -243,7 +275,7 @@ namespace NIMBLE {
 				}
 			} catch(...) { }
 
-			m_token = token;
+			m_token = token.uid();
 
 			try {
 				if(fact 
@@ -264,7 +296,6 @@ namespace NIMBLE {
 			std::string result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = nimble_node::as_string(*this, verbose);
 
@@ -276,15 +307,15 @@ namespace NIMBLE {
 		_nimble_node::token(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_token.to_string(true)));
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(nimble_uid::as_string(m_token, true)));
 			return m_token;
 		}
 
 		nimble_node_factory_ptr nimble_node_factory::m_instance = NULL;
 
 		_nimble_node_factory::_nimble_node_factory(void) :
-			m_initialized(false)
+			nimble_object_factory<nimble_node, 
+				nimble_storage_pool<nimble_node>, nimble_lock_policy>(NIMBLE_NODE_HEADER)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -345,171 +376,6 @@ namespace NIMBLE {
 			return result;
 		}
 
-		nimble_node &
-		_nimble_node_factory::at(
-			__in const nimble_uid &uid
-			)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			nimble_node &node = find(uid)->second.first;
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(node.to_string(true)));
-			return node;
-		}
-
-		bool 
-		_nimble_node_factory::contains(
-			__in const nimble_uid &uid
-			)
-		{
-			bool result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = (m_map.find(uid) != m_map.end());
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
-			return result;
-		}
-
-		size_t 
-		_nimble_node_factory::decrement_reference(
-			__in const nimble_uid &uid
-			)
-		{
-			size_t result;
-			std::map<nimble_uid, std::pair<nimble_node, size_t>>::iterator iter;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			iter = find(uid);
-
-			result = --iter->second.second;
-			if(result < REF_INITIAL) {
-				TRACE_MESSAGE(TRACE_INFORMATION, "Removing node instance, %s", 
-					CHK_STR(nimble_node::as_string(iter->second.first, true)));
-				m_map.erase(iter);
-			}
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		std::map<nimble_uid, std::pair<nimble_node, size_t>>::iterator 
-		_nimble_node_factory::find(
-			__in const nimble_uid &uid
-			)
-		{
-			std::map<nimble_uid, std::pair<nimble_node, size_t>>::iterator result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = m_map.find(uid);
-			if(result == m_map.end()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED),
-					CHK_STR(nimble_uid::as_string(uid, true)));
-				THROW_NIMBLE_NODE_EXCEPTION_MESSAGE(NIMBLE_NODE_EXCEPTION_NOT_FOUND,
-					"%s", CHK_STR(nimble_uid::as_string(uid, true)));
-			}
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
-			return result;
-		}
-
-		nimble_uid 
-		_nimble_node_factory::generate(void)
-		{
-			nimble_node node;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			TRACE_MESSAGE(TRACE_INFORMATION, "Generating new node: %s", 
-				CHK_STR(node.to_string(true)));
-			m_map.insert(std::pair<nimble_uid, std::pair<nimble_node, size_t>>(node.uid(),
-				std::pair<nimble_node, size_t>(node, REF_INITIAL)));
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(node.to_string(true)));
-			return node.uid();
-		}
-
-		size_t 
-		_nimble_node_factory::increment_reference(
-			__in const nimble_uid &uid
-			)
-		{
-			size_t result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = ++find(uid)->second.second;
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		void 
-		_nimble_node_factory::initialize(void)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_INITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_INITIALIZED);
-			}
-
-			m_initialized = true;
-			m_map.clear();
-			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Node component instance initialized");
-
-			TRACE_EXIT(TRACE_VERBOSE);
-		}
-
 		bool 
 		_nimble_node_factory::is_allocated(void)
 		{
@@ -522,102 +388,5 @@ namespace NIMBLE {
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
 		}
-
-		bool 
-		_nimble_node_factory::is_initialized(void)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_initialized);
-			return m_initialized;
-		}
-
-		size_t 
-		_nimble_node_factory::reference_count(
-			__in const nimble_uid &uid
-			)
-		{
-			size_t result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = find(uid)->second.second;
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		size_t 
-		_nimble_node_factory::size(void)
-		{
-			size_t result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = m_map.size();
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		std::string 
-		_nimble_node_factory::to_string(
-			__in_opt bool verbose
-			)
-		{
-			std::stringstream result;
-			std::map<nimble_uid, std::pair<nimble_node, size_t>>::iterator iter;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			result << "(" << (m_initialized ? "INIT" : "UNINIT") << ") " << NIMBLE_NODE_HEADER 
-				<< "[" << m_map.size() << "]";
-
-			if(verbose) {
-				result << " (" << VAL_AS_HEX(nimble_node_factory_ptr, this) << ")";
-
-				for(iter = m_map.begin(); iter != m_map.end(); ++iter) {
-					result << std::endl << "--- " << nimble_node::as_string(iter->second.first, true)
-						<< ", ref. " << iter->second.second;
-				}
-			} 
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
-			return CHK_STR(result.str());
-		}
-
-		void 
-		_nimble_node_factory::uninitialize(void)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_NODE_EXCEPTION_STRING(NIMBLE_NODE_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_NODE_EXCEPTION(NIMBLE_NODE_EXCEPTION_UNINITIALIZED);
-			}
-
-			m_map.clear();
-			m_initialized = false;
-			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Node component instance uninitialized");
-
-			TRACE_EXIT(TRACE_VERBOSE);
-		}
 	}
 }
@@ -26,14 +26,19 @@ namespace NIMBLE {
 
 		#define SENTINEL_PARSER 2
 
+		nimble_stats _nimble_parser::m_stmt_stats;
+
 		_nimble_parser::_nimble_parser(
 			__in_opt const std::string &input,
 			__in_opt bool is_file
 			) :
-				m_stmt_position(0)
+				m_stmt_bytes(0),
+				m_stmt_position(0),
+				m_time_parse(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
+			m_stmt_stats.allocate();
 			nimble_parser::set(input, is_file);
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -41,10 +46,13 @@ namespace NIMBLE {
 
 		_nimble_parser::_nimble_parser(
 			__in const _nimble_parser &other
-			)
+			) :
+				m_stmt_bytes(0),
+				m_time_parse(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
+			m_stmt_stats.allocate();
 			nimble_parser::set(other);
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -55,6 +63,8 @@ namespace NIMBLE {
 			TRACE_ENTRY(TRACE_VERBOSE);
 
 			nimble_parser::clear();
+			nimble_parser::update_statement_stats(0);
+			m_stmt_stats.release();
 
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
@@ -65,7 +75,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				nimble_parser::set(other);
@@ -85,7 +94,7 @@ namespace NIMBLE {
 			)
 		{
 			size_t tab_iter;
-			std::vector<size_t>::iterator child_iter;
+			nimble_node_children::iterator child_iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -150,7 +159,6 @@ namespace NIMBLE {
 			std::vector<nimble_statement>::iterator stmt_iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			try {
 
@@ -173,6 +181,8 @@ namespace NIMBLE {
 
 			m_stmt_list.clear();
 			m_stmt_position = 0;
+			nimble_parser::update_statement_stats(m_stmt_list.capacity() 
+				* sizeof(nimble_statement));
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Parser cleared");
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -187,7 +197,6 @@ namespace NIMBLE {
 			nimble_token_factory_ptr fact = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			fact = nimble_lexer::acquire_token();
 			result = fact->generate();
@@ -204,16 +213,15 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			tok = token();
-			if(tok.type() == TOKEN_SYMBOL) {
+			tok = &token();
+			if(tok->type() == TOKEN_SYMBOL) {
 
-				switch(tok.subtype()) {
+				switch(tok->subtype()) {
 					case SYMBOL_MODIFIER:
 						result = insert_node(stmt, create_token(TOKEN_STATEMENT), result);
 						enumerate_statement_assignment(stmt, result);
@@ -230,11 +238,11 @@ namespace NIMBLE {
 						}
 						break;
 					default:
-						TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+						TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 							NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_STATEMENT),
-							CHK_STR(nimble_lexer::token_exception(0, true)));
-						THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_STATEMENT,
-							"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+							CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+						THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_STATEMENT,
+							nimble_lexer::token_diagnostic());
 				}
 			} else {
 				result = insert_node(stmt, create_token(TOKEN_STATEMENT), result);
@@ -254,38 +262,37 @@ namespace NIMBLE {
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = insert_node(stmt, create_token(TOKEN_ARGUMENT), result);
 
-			nimble_token tok = token();
-			if((tok.type() != TOKEN_SYMBOL)
-					|| (tok.subtype() != SYMBOL_MODIFIER)) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+			nimble_token_ptr tok = &token();
+			if((tok->type() != TOKEN_SYMBOL)
+					|| (tok->subtype() != SYMBOL_MODIFIER)) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_MODIFIER),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_MODIFIER,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_MODIFIER,
+					nimble_lexer::token_diagnostic());
 			}
 
 			if(!has_next_token()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL,
+					nimble_lexer::token_diagnostic());
 			}
 
-			tok = move_next_token();
-			if(tok.type() != TOKEN_LITERAL) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+			tok = &move_next_token();
+			if(tok->type() != TOKEN_LITERAL) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL,
+					nimble_lexer::token_diagnostic());
 			}
 
-			insert_node(stmt, tok, result);
+			insert_node(stmt, *tok, result);
 
 			if(has_next_token()) {
 				move_next_token();
@@ -304,45 +311,44 @@ namespace NIMBLE {
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = insert_node(stmt, create_token(TOKEN_ASSIGNMENT), result);
 			enumerate_statement_argument(stmt, result);
 
-			nimble_token tok = token();
-			if((tok.type() != TOKEN_SYMBOL)
-					|| (tok.subtype() != SYMBOL_ASSIGNMENT)) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+			nimble_token_ptr tok = &token();
+			if((tok->type() != TOKEN_SYMBOL)
+					|| (tok->subtype() != SYMBOL_ASSIGNMENT)) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_ASSIGNMENT),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_ASSIGNMENT,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_ASSIGNMENT,
+					nimble_lexer::token_diagnostic());
 			}
 
 			if(!has_next_token()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_STATEMENT),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_STATEMENT,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_STATEMENT,
+					nimble_lexer::token_diagnostic());
 			}
 
-			tok = move_next_token();
-			if((tok.type() == TOKEN_SYMBOL)
-					&& (tok.subtype() == SYMBOL_MODIFIER)) {
+			tok = &move_next_token();
+			if((tok->type() == TOKEN_SYMBOL)
+					&& (tok->subtype() == SYMBOL_MODIFIER)) {
 				enumerate_statement_argument(stmt, result);
-			} else if(tok.type() == TOKEN_LITERAL) {
-				insert_node(stmt, tok, result);
+			} else if(tok->type() == TOKEN_LITERAL) {
+				insert_node(stmt, *tok, result);
 
 				if(has_next_token()) {
 					move_next_token();
 				}
 			} else {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_LITERAL,
+					nimble_lexer::token_diagnostic());
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -355,34 +361,33 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			tok = token();
-			if(tok.type() == TOKEN_LITERAL) {
+			tok = &token();
+			if(tok->type() == TOKEN_LITERAL) {
 				result = insert_node(stmt, create_token(TOKEN_CALL), result);
-				insert_node(stmt, tok, result);
+				insert_node(stmt, *tok, result);
 
 				if(has_next_token()) {
-					tok = move_next_token();
+					tok = &move_next_token();
 
 					for(;;) {
 
-						if((tok.type() == TOKEN_SYMBOL)
-								&& (tok.subtype() == SYMBOL_MODIFIER)) {
+						if((tok->type() == TOKEN_SYMBOL)
+								&& (tok->subtype() == SYMBOL_MODIFIER)) {
 							enumerate_statement_argument(stmt, result);
-							tok = token();
-						} else if(tok.type() == TOKEN_LITERAL) {
-							insert_node(stmt, tok, result);
+							tok = &token();
+						} else if(tok->type() == TOKEN_LITERAL) {
+							insert_node(stmt, *tok, result);
 
 							if(!has_next_token()) {
 								break;
 							}
 
-							tok = move_next_token();
+							tok = &move_next_token();
 						} else {
 							break;
 						}
@@ -400,35 +405,34 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = insert_node(stmt, create_token(TOKEN_CALL_LIST), result);
 
 			enumerate_statement_call(stmt, result);
 
-			tok = token();
+			tok = &token();
 			for(;;) {
 
-				if((tok.type() != TOKEN_SYMBOL)
-						|| (tok.subtype() != SYMBOL_SEPERATOR)) {
+				if((tok->type() != TOKEN_SYMBOL)
+						|| (tok->subtype() != SYMBOL_SEPERATOR)) {
 					break;
 				}
 
 				if(!has_next_token()) {
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 						NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-						CHK_STR(nimble_lexer::token_exception(0, true)));
-					THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-						"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+						CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+					THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
+						nimble_lexer::token_diagnostic());
 				}
 
 				move_next_token();
 				enumerate_statement_call(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -441,20 +445,19 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = insert_node(stmt, create_token(TOKEN_COMMAND), result);
 			enumerate_statement_command_1(stmt, result);
 
-			tok = token();
-			while((tok.type() == TOKEN_SYMBOL)
-					&& (tok.subtype() == SYMBOL_REDIRECT_IN)) {
+			tok = &token();
+			while((tok->type() == TOKEN_SYMBOL)
+					&& (tok->subtype() == SYMBOL_REDIRECT_IN)) {
 				enumerate_statement_command_0_tail(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -467,40 +470,39 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			tok = token();
-			if((tok.type() != TOKEN_SYMBOL)
-					|| (tok.subtype() != SYMBOL_REDIRECT_IN)) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+			tok = &token();
+			if((tok->type() != TOKEN_SYMBOL)
+					|| (tok->subtype() != SYMBOL_REDIRECT_IN)) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_IN),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_IN,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_IN,
+					nimble_lexer::token_diagnostic());
 			}
 
-			result = insert_node(stmt, tok, result);
+			result = insert_node(stmt, *tok, result);
 
 			if(!has_next_token()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
+					nimble_lexer::token_diagnostic());
 			}
 
 			move_next_token();
 			enumerate_statement_command_1(stmt, result);
 
-			tok = token();
-			while((tok.type() == TOKEN_SYMBOL)
-					&& (tok.subtype() == SYMBOL_REDIRECT_IN)) {
+			tok = &token();
+			while((tok->type() == TOKEN_SYMBOL)
+					&& (tok->subtype() == SYMBOL_REDIRECT_IN)) {
 				enumerate_statement_command_0_tail(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -513,24 +515,23 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			enumerate_statement_command_2(stmt, result);
 
-			tok = token();
-			while((tok.type() == TOKEN_SYMBOL)
-					&& ((tok.subtype() == SYMBOL_REDIRECT_OUT)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_APPEND)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_ERR)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_ERR_APPEND)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_ERR_OVERWRITE)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_OVERWRITE))) {
+			tok = &token();
+			while((tok->type() == TOKEN_SYMBOL)
+					&& ((tok->subtype() == SYMBOL_REDIRECT_OUT)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_APPEND)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_ERR)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_ERR_APPEND)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_ERR_OVERWRITE)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_OVERWRITE))) {
 				enumerate_statement_command_1_tail(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -543,50 +544,49 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			tok = token();
-			if((tok.type() != TOKEN_SYMBOL)
-					|| ((tok.subtype() != SYMBOL_REDIRECT_OUT)
-					&& (tok.subtype() != SYMBOL_REDIRECT_OUT_APPEND)
-					&& (tok.subtype() != SYMBOL_REDIRECT_OUT_ERR)
-					&& (tok.subtype() != SYMBOL_REDIRECT_OUT_ERR_APPEND)
-					&& (tok.subtype() != SYMBOL_REDIRECT_OUT_ERR_OVERWRITE)
-					&& (tok.subtype() != SYMBOL_REDIRECT_OUT_OVERWRITE))) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+
+			tok = &token();
+			if((tok->type() != TOKEN_SYMBOL)
+					|| ((tok->subtype() != SYMBOL_REDIRECT_OUT)
+					&& (tok->subtype() != SYMBOL_REDIRECT_OUT_APPEND)
+					&& (tok->subtype() != SYMBOL_REDIRECT_OUT_ERR)
+					&& (tok->subtype() != SYMBOL_REDIRECT_OUT_ERR_APPEND)
+					&& (tok->subtype() != SYMBOL_REDIRECT_OUT_ERR_OVERWRITE)
+					&& (tok->subtype() != SYMBOL_REDIRECT_OUT_OVERWRITE))) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_OUT),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_OUT,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_OUT,
+					nimble_lexer::token_diagnostic());
 			}
 
-			result = insert_node(stmt, tok, result);
+			result = insert_node(stmt, *tok, result);
 
 			if(!has_next_token()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
+					nimble_lexer::token_diagnostic());
 			}
 
 			move_next_token();
 			enumerate_statement_command_2(stmt, result);
 
-			tok = token();
-			while((tok.type() == TOKEN_SYMBOL)
-					&& ((tok.subtype() == SYMBOL_REDIRECT_OUT)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_APPEND)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_ERR)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_ERR_APPEND)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_ERR_OVERWRITE)
-					|| (tok.subtype() == SYMBOL_REDIRECT_OUT_OVERWRITE))) {
+			tok = &token();
+			while((tok->type() == TOKEN_SYMBOL)
+					&& ((tok->subtype() == SYMBOL_REDIRECT_OUT)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_APPEND)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_ERR)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_ERR_APPEND)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_ERR_OVERWRITE)
+					|| (tok->subtype() == SYMBOL_REDIRECT_OUT_OVERWRITE))) {
 				enumerate_statement_command_1_tail(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -599,19 +599,18 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			enumerate_statement_command_3(stmt, result);
 
-			tok = token();
-			while((tok.type() == TOKEN_SYMBOL)
-					&& (tok.subtype() == SYMBOL_PIPE)) {
+			tok = &token();
+			while((tok->type() == TOKEN_SYMBOL)
+					&& (tok->subtype() == SYMBOL_PIPE)) {
 				enumerate_statement_command_2_tail(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -624,40 +623,39 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			tok = token();
-			if((tok.type() != TOKEN_SYMBOL)
-					|| (tok.subtype() != SYMBOL_PIPE)) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+			tok = &token();
+			if((tok->type() != TOKEN_SYMBOL)
+					|| (tok->subtype() != SYMBOL_PIPE)) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_IN),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_IN,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_REDIRECT_IN,
+					nimble_lexer::token_diagnostic());
 			}
 
-			result = insert_node(stmt, tok, result);
+			result = insert_node(stmt, *tok, result);
 
 			if(!has_next_token()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-					CHK_STR(nimble_lexer::token_exception(0, true)));
-				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-					"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+					CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+				THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
+					nimble_lexer::token_diagnostic());
 			}
 
 			move_next_token();
 			enumerate_statement_command_3(stmt, result);
 
-			tok = token();
-			while((tok.type() == TOKEN_SYMBOL)
-					&& (tok.subtype() == SYMBOL_PIPE)) {
+			tok = &token();
+			while((tok->type() == TOKEN_SYMBOL)
+					&& (tok->subtype() == SYMBOL_PIPE)) {
 				enumerate_statement_command_2_tail(stmt, result);
-				tok = token();
+				tok = &token();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -670,48 +668,47 @@ namespace NIMBLE {
 			__in_opt size_t parent
 			)
 		{
-			nimble_token tok;
+			nimble_token_ptr tok = NULL;
 			size_t result = parent;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
-			tok = token();
-			switch(tok.type()) {
+			tok = &token();
+			switch(tok->type()) {
 				case TOKEN_LITERAL:
 					enumerate_statement_call_list(stmt, result);
 					break;
 				case TOKEN_SYMBOL:
 
-					switch(tok.subtype()) {
+					switch(tok->subtype()) {
 						case SYMBOL_MODIFIER:
 							enumerate_statement_argument(stmt, result);
 							break;
 						case SYMBOL_OPEN_PARENTHESIS:
 
 							if(!has_next_token()) {
-								TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+								TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 									NIMBLE_PARSER_EXCEPTION_STRING(
 									NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-									CHK_STR(nimble_lexer::token_exception(0, true)));
-								THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(
+									CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+								THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(
 									NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-									"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+									nimble_lexer::token_diagnostic());
 							}
 
 							move_next_token();
 							enumerate_statement_command_0(stmt, result);
-							tok = token();
+							tok = &token();
 
-							if((tok.type() != TOKEN_SYMBOL)
-									|| (tok.subtype() != SYMBOL_CLOSE_PARENTHESIS)) {
-								TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+							if((tok->type() != TOKEN_SYMBOL)
+									|| (tok->subtype() != SYMBOL_CLOSE_PARENTHESIS)) {
+								TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 									NIMBLE_PARSER_EXCEPTION_STRING(
 									NIMBLE_PARSER_EXCEPTION_EXPECTING_CLOSING_PARETHESIS),
-									CHK_STR(nimble_lexer::token_exception(0, true)));
-								THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(
+									CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+								THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(
 									NIMBLE_PARSER_EXCEPTION_EXPECTING_CLOSING_PARETHESIS,
-									"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+									nimble_lexer::token_diagnostic());
 							}
 
 							if(has_next_token()) {
@@ -725,21 +722,21 @@ namespace NIMBLE {
 							}
 							break;
 						default:
-							TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", 
+							TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
 								NIMBLE_PARSER_EXCEPTION_STRING(
 								NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-								CHK_STR(nimble_lexer::token_exception(0, true)));
-							THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(
+								CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+							THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(
 								NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-								"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+								nimble_lexer::token_diagnostic());
 					}
 					break;
 				default:
-					TRACE_MESSAGE(TRACE_ERROR, "%s\n%s", NIMBLE_PARSER_EXCEPTION_STRING(
+					TRACE_MESSAGE(TRACE_ERROR, "%s, %s", NIMBLE_PARSER_EXCEPTION_STRING(
 						NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND),
-						CHK_STR(nimble_lexer::token_exception(0, true)));
-					THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
-						"%s", CHK_STR(nimble_lexer::token_exception(0, true)));
+						CHK_STR(nimble_lexer::token_diagnostic().to_string()));
+					THROW_NIMBLE_PARSER_EXCEPTION_DIAGNOSTIC(NIMBLE_PARSER_EXCEPTION_EXPECTING_COMMAND,
+						nimble_lexer::token_diagnostic());
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -752,7 +749,6 @@ namespace NIMBLE {
 			size_t result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			while(has_next_statement()) {
 				move_next_statement();
@@ -775,7 +771,6 @@ namespace NIMBLE {
 			nimble_token_factory_ptr tok_fact = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			node_fact = nimble_parser::acquire_node();
 			tok_fact = nimble_lexer::acquire_token();
@@ -791,7 +786,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_stmt_position > 0);
 
@@ -812,16 +806,24 @@ namespace NIMBLE {
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 
+			result = stmt.size();
+			if(result >= PAR_INVALID) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
+					NIMBLE_PARSER_EXCEPTION_STRING(NIMBLE_PARSER_EXCEPTION_STATEMENT_TOO_LARGE),
+					result);
+				THROW_NIMBLE_PARSER_EXCEPTION_MESSAGE(NIMBLE_PARSER_EXCEPTION_STATEMENT_TOO_LARGE,
+					"%lu", result);
+			}
+
 			fact = nimble_parser::acquire_node();
 			uid = fact->generate();
 			nimble_node &node = fact->at(uid);
 			node.set(token);
-			node.parent() = parent;
-			result = stmt.size();
+			node.parent() = (nimble_node_index_t) parent;
 			stmt.push_back(uid);
 
 			if(parent != PAR_INVALID) {
-				fact->at(stmt.at(parent)).children().push_back(result);
+				fact->at(stmt.at(parent)).children().push_back((nimble_node_index_t) result);
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
@@ -830,31 +832,36 @@ namespace NIMBLE {
 
 		void 
 		_nimble_parser::insert_statement(
-			__in const nimble_statement &stmt
+			__in nimble_statement &&stmt
 			)
 		{
-			size_t position;
+			size_t bytes, position;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
+
+			bytes = (m_stmt_bytes + (stmt.capacity() * sizeof(nimble_uid))
+				- (m_stmt_list.capacity() * sizeof(nimble_statement)));
 
 			position = m_stmt_position + 1;
 			if(position < m_stmt_list.size()) {
-				m_stmt_list.insert(m_stmt_list.begin() + position, stmt);
+				m_stmt_list.insert(m_stmt_list.begin() + position, std::move(stmt));
 			} else {
-				m_stmt_list.push_back(stmt);
+				m_stmt_list.push_back(std::move(stmt));
 			}
 
+			nimble_parser::update_statement_stats(bytes 
+				+ (m_stmt_list.capacity() * sizeof(nimble_statement)));
+
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
 		nimble_statement &
 		_nimble_parser::move_next_statement(void)
 		{
+			uint64_t begin = 0;
 			nimble_statement stmt_new;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!has_next_statement()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -870,8 +877,16 @@ namespace NIMBLE {
 
 			if(has_next_token()
 					&& (m_stmt_position <= (m_stmt_list.size() - SENTINEL_PARSER))) {
+				begin = ((m_timed || PROBE_ACTIVE(parse__end)) ? nimble_probe::now() : 0);
+				PROBE1(parse__start, m_stmt_position + 1);
 				enumerate_statement(stmt_new);
-				insert_statement(stmt_new);
+				PROBE3(parse__end, m_stmt_position + 1, stmt_new.size(), 
+					PROBE_ELAPSED(parse__end, begin));
+
+				if(m_timed) {
+					m_time_parse += (nimble_probe::now() - begin);
+				}
+				insert_statement(std::move(stmt_new));
 			}
 
 			++m_stmt_position;
@@ -888,7 +903,6 @@ namespace NIMBLE {
 		_nimble_parser::move_previous_statement(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(!has_previous_statement()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -938,7 +952,6 @@ namespace NIMBLE {
 		_nimble_parser::reset(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			m_stmt_position = 0;
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Parser reset");
@@ -955,14 +968,13 @@ namespace NIMBLE {
 			nimble_statement stmt_beg, stmt_end;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_parser::clear();
 			nimble_lexer::set(input, is_file);
 			insert_node(stmt_beg, token_begin());
 			insert_node(stmt_end, token_end());
-			insert_statement(stmt_beg);
-			insert_statement(stmt_end);
+			insert_statement(std::move(stmt_beg));
+			insert_statement(std::move(stmt_end));
 
 			nimble_parser::reset();
 			TRACE_MESSAGE(TRACE_INFORMATION, "Parser set input -> \'%s\', file -> 0x%x", 
@@ -976,17 +988,18 @@ namespace NIMBLE {
 			__in const _nimble_parser &other
 			)
 		{
+			size_t bytes;
 			nimble_node_factory_ptr fact = NULL;
 			nimble_statement::iterator node_iter;
 			std::vector<nimble_statement>::iterator stmt_iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			nimble_parser::clear();
 			nimble_lexer::operator=(other);
 			m_stmt_list = other.m_stmt_list;
 			m_stmt_position = other.m_stmt_position;
+			bytes = (m_stmt_list.capacity() * sizeof(nimble_statement));
 
 			try {
 
@@ -1007,6 +1020,12 @@ namespace NIMBLE {
 				}
 			} catch(...) { }
 
+			for(stmt_iter = m_stmt_list.begin(); stmt_iter != m_stmt_list.end(); ++stmt_iter) {
+				bytes += (stmt_iter->capacity() * sizeof(nimble_uid));
+			}
+
+			nimble_parser::update_statement_stats(bytes);
+
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
@@ -1016,7 +1035,6 @@ namespace NIMBLE {
 			size_t result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (!m_stmt_list.empty() ? (m_stmt_list.size() - SENTINEL_PARSER) : 0);
 
@@ -1028,7 +1046,6 @@ namespace NIMBLE {
 		_nimble_parser::statement(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(m_stmt_position >= m_stmt_list.size()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, pos. %lu", 
@@ -1065,7 +1082,6 @@ namespace NIMBLE {
 		_nimble_parser::statement_begin(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(m_stmt_list.empty()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s", 
@@ -1084,7 +1100,6 @@ namespace NIMBLE {
 		_nimble_parser::statement_end(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(m_stmt_list.empty()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s", 
@@ -1099,6 +1114,19 @@ namespace NIMBLE {
 			return stmt;
 		}
 
+		nimble_diagnostic 
+		_nimble_parser::statement_diagnostic(void)
+		{
+			nimble_diagnostic result;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			result = nimble_lexer::token_diagnostic();
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.to_string(true)));
+			return result;
+		}
+
 		std::string 
 		_nimble_parser::statement_exception(
 			__in_opt size_t tabs,
@@ -1108,7 +1136,6 @@ namespace NIMBLE {
 			std::stringstream result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result << nimble_lexer::token_exception(tabs, verbose);
 
@@ -1120,11 +1147,18 @@ namespace NIMBLE {
 		_nimble_parser::statement_position(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_stmt_position);
 			return m_stmt_position;
 		}
 
+		const nimble_stats &
+		_nimble_parser::statement_stats(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &m_stmt_stats);
+			return m_stmt_stats;
+		}
+
 		std::string 
 		_nimble_parser::to_string(
 			__in_opt bool verbose
@@ -1133,7 +1167,6 @@ namespace NIMBLE {
 			std::stringstream result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(verbose) {
 				result << "(" << m_stmt_position << "/" << (m_stmt_list.size() - 1) << ") ";
@@ -1152,5 +1185,18 @@ namespace NIMBLE {
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
 			return CHK_STR(result.str());
 		}
+
+		void 
+		_nimble_parser::update_statement_stats(
+			__in size_t bytes
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			m_stmt_stats.resize(m_stmt_bytes, bytes);
+			m_stmt_bytes = bytes;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
 	}
 }
@@ -0,0 +1,34 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/nimble.h"
+
+namespace NIMBLE {
+
+	PROBE_DEFINE(exec)
+	PROBE_DEFINE(fork)
+	PROBE_DEFINE(lex__end)
+	PROBE_DEFINE(lex__start)
+	PROBE_DEFINE(line__read)
+	PROBE_DEFINE(parse__end)
+	PROBE_DEFINE(parse__start)
+	PROBE_DEFINE(statement__end)
+	PROBE_DEFINE(statement__start)
+	PROBE_DEFINE(wait__done)
+}
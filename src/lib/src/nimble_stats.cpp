@@ -0,0 +1,249 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/nimble.h"
+
+namespace NIMBLE {
+
+	#define STATS_WIDTH_NAME 12
+	#define STATS_WIDTH_VALUE 12
+
+	_nimble_stats::_nimble_stats(void) :
+		m_begin(std::chrono::steady_clock::now()),
+		m_bytes(0),
+		m_created(0),
+		m_live(0),
+		m_peak(0),
+		m_released(0)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	_nimble_stats::~_nimble_stats(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble_stats::allocate(void)
+	{
+		size_t live, peak;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		m_created.fetch_add(1, std::memory_order_relaxed);
+		live = (m_live.fetch_add(1, std::memory_order_relaxed) + 1);
+		peak = m_peak.load(std::memory_order_relaxed);
+
+		while((live > peak) && !m_peak.compare_exchange_weak(peak, live, 
+				std::memory_order_relaxed));
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	std::string 
+	_nimble_stats::as_string(
+		__in const std::string &name,
+		__in const _nimble_stats &stats,
+		__in_opt bool json
+		)
+	{
+		std::stringstream result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(json) {
+			result << "\"" << name << "\":{\"live\":" << stats.live() 
+				<< ",\"peak\":" << stats.peak() << ",\"created\":" << stats.created()
+				<< ",\"released\":" << stats.released() << ",\"bytes\":" << stats.bytes()
+				<< ",\"churn\":" << std::fixed << std::setprecision(3) << stats.churn() << "}";
+		} else {
+			result << std::left << std::setw(STATS_WIDTH_NAME) << name << std::right
+				<< std::setw(STATS_WIDTH_VALUE) << stats.live()
+				<< std::setw(STATS_WIDTH_VALUE) << stats.peak()
+				<< std::setw(STATS_WIDTH_VALUE) << stats.created()
+				<< std::setw(STATS_WIDTH_VALUE) << stats.released()
+				<< std::setw(STATS_WIDTH_VALUE) << stats.bytes()
+				<< std::setw(STATS_WIDTH_VALUE) << std::fixed << std::setprecision(1) 
+				<< stats.churn();
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
+		return CHK_STR(result.str());
+	}
+
+	size_t 
+	_nimble_stats::bytes(void) const
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = m_bytes.load(std::memory_order_relaxed);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	double 
+	_nimble_stats::churn(void) const
+	{
+		double elapsed, result = 0.0;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		elapsed = _nimble_stats::elapsed();
+		if(elapsed > 0.0) {
+			result = (released() / elapsed);
+		}
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %f", result);
+		return result;
+	}
+
+	size_t 
+	_nimble_stats::created(void) const
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = m_created.load(std::memory_order_relaxed);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	double 
+	_nimble_stats::elapsed(void) const
+	{
+		double result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = std::chrono::duration<double>(std::chrono::steady_clock::now() 
+			- m_begin).count();
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %f", result);
+		return result;
+	}
+
+	std::string 
+	_nimble_stats::header(void)
+	{
+		std::stringstream result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result << std::left << std::setw(STATS_WIDTH_NAME) << "NAME" << std::right
+			<< std::setw(STATS_WIDTH_VALUE) << "LIVE"
+			<< std::setw(STATS_WIDTH_VALUE) << "PEAK"
+			<< std::setw(STATS_WIDTH_VALUE) << "CREATED"
+			<< std::setw(STATS_WIDTH_VALUE) << "RELEASED"
+			<< std::setw(STATS_WIDTH_VALUE) << "BYTES"
+			<< std::setw(STATS_WIDTH_VALUE) << "CHURN/S";
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
+		return CHK_STR(result.str());
+	}
+
+	size_t 
+	_nimble_stats::live(void) const
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = m_live.load(std::memory_order_relaxed);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	size_t 
+	_nimble_stats::peak(void) const
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = m_peak.load(std::memory_order_relaxed);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble_stats::release(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		m_live.fetch_sub(1, std::memory_order_relaxed);
+		m_released.fetch_add(1, std::memory_order_relaxed);
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	size_t 
+	_nimble_stats::released(void) const
+	{
+		size_t result;
+
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		result = m_released.load(std::memory_order_relaxed);
+
+		TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
+		return result;
+	}
+
+	void 
+	_nimble_stats::reset(void)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		m_begin = std::chrono::steady_clock::now();
+		m_bytes.store(0, std::memory_order_relaxed);
+		m_created.store(0, std::memory_order_relaxed);
+		m_live.store(0, std::memory_order_relaxed);
+		m_peak.store(0, std::memory_order_relaxed);
+		m_released.store(0, std::memory_order_relaxed);
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+
+	void 
+	_nimble_stats::resize(
+		__in size_t previous,
+		__in size_t current
+		)
+	{
+		TRACE_ENTRY(TRACE_VERBOSE);
+
+		if(current > previous) {
+			m_bytes.fetch_add(current - previous, std::memory_order_relaxed);
+		} else if(current < previous) {
+			m_bytes.fetch_sub(previous - current, std::memory_order_relaxed);
+		}
+
+		TRACE_EXIT(TRACE_VERBOSE);
+	}
+}
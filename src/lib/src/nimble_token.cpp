@@ -26,6 +26,7 @@ namespace NIMBLE {
 
 		_nimble_token::_nimble_token(void) :
 			m_column(0),
+			m_hash(ENV_HASH_INVALID),
 			m_position(0),
 			m_row(0),
 			m_subtype(TOKSUB_INVALID),
@@ -41,6 +42,7 @@ namespace NIMBLE {
 			) :
 				nimble_uid_class(other),
 				m_column(other.m_column),
+				m_hash(other.m_hash),
 				m_path(other.m_path),
 				m_position(other.m_position),
 				m_row(other.m_row),
@@ -53,6 +55,24 @@ namespace NIMBLE {
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
+		_nimble_token::_nimble_token(
+			__in _nimble_token &&other
+			) :
+				nimble_uid_class(std::move(other)),
+				m_column(other.m_column),
+				m_hash(other.m_hash),
+				m_path(std::move(other.m_path)),
+				m_position(other.m_position),
+				m_row(other.m_row),
+				m_subtype(other.m_subtype),
+				m_text(std::move(other.m_text)),
+				m_type(other.m_type),
+				m_value(other.m_value)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
 		_nimble_token::~_nimble_token(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
@@ -65,11 +85,11 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 				nimble_uid_class::operator=(other);
 				m_column = other.m_column;
+				m_hash = other.m_hash;
 				m_path = other.m_path;
 				m_position = other.m_position;
 				m_row = other.m_row;
@@ -83,6 +103,30 @@ namespace NIMBLE {
 			return *this;
 		}
 
+		_nimble_token &
+		_nimble_token::operator=(
+			__in _nimble_token &&other
+			)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+				nimble_uid_class::operator=(std::move(other));
+				m_column = other.m_column;
+				m_hash = other.m_hash;
+				m_path = std::move(other.m_path);
+				m_position = other.m_position;
+				m_row = other.m_row;
+				m_subtype = other.m_subtype;
+				m_text = std::move(other.m_text);
+				m_type = other.m_type;
+				m_value = other.m_value;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
 		std::string 
 		_nimble_token::as_string(
 			__in const _nimble_token &tok,
@@ -142,9 +186,9 @@ namespace NIMBLE {
 		_nimble_token::clear(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			m_column = 0;
+			m_hash = ENV_HASH_INVALID;
 			m_path.clear();
 			m_position = 0;
 			m_row = 0;
@@ -160,11 +204,18 @@ namespace NIMBLE {
 		_nimble_token::column(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_column);
 			return m_column;
 		}
 
+		uint32_t &
+		_nimble_token::hash(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_hash);
+			return m_hash;
+		}
+
 		nimble_token_meta 
 		_nimble_token::meta(
 			__in_opt size_t column,
@@ -174,7 +225,6 @@ namespace NIMBLE {
 			nimble_token_meta result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = nimble_token_meta(m_text, m_path, column, m_column, row, m_row);
 
@@ -186,7 +236,6 @@ namespace NIMBLE {
 		_nimble_token::path(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_path));
 			return m_path;
 		}
@@ -195,7 +244,6 @@ namespace NIMBLE {
 		_nimble_token::position(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_position);
 			return m_position;
 		}
@@ -204,7 +252,6 @@ namespace NIMBLE {
 		_nimble_token::row(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_row);
 			return m_row;
 		}
@@ -213,7 +260,6 @@ namespace NIMBLE {
 		_nimble_token::subtype(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s (0x%x)", 
 				CHK_STR(nimble_language::subtype_as_string(m_type, m_subtype)), 
 				m_subtype);
@@ -224,7 +270,6 @@ namespace NIMBLE {
 		_nimble_token::text(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(m_text));
 			return m_text;
 		}
@@ -237,7 +282,6 @@ namespace NIMBLE {
 			std::string result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = nimble_token::as_string(*this, verbose);
 
@@ -249,7 +293,6 @@ namespace NIMBLE {
 		_nimble_token::type(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s (0x%x)", 
 				CHK_STR(nimble_language::type_as_string(m_type)), m_type);
 			return m_type;
@@ -259,7 +302,6 @@ namespace NIMBLE {
 		_nimble_token::value(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %.8f", m_value);
 			return m_value;
 		}
@@ -267,7 +309,8 @@ namespace NIMBLE {
 		nimble_token_factory_ptr nimble_token_factory::m_instance = NULL;
 
 		_nimble_token_factory::_nimble_token_factory(void) :
-			m_initialized(false)
+			nimble_object_factory<nimble_token, 
+				nimble_storage_pool<nimble_token>, nimble_lock_policy>(NIMBLE_TOKEN_HEADER)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -328,171 +371,6 @@ namespace NIMBLE {
 			return result;
 		}
 
-		nimble_token &
-		_nimble_token_factory::at(
-			__in const nimble_uid &uid
-			)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			nimble_token &tok = find(uid)->second.first;
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(tok.to_string(true)));
-			return tok;
-		}
-
-		bool 
-		_nimble_token_factory::contains(
-			__in const nimble_uid &uid
-			)
-		{
-			bool result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = (m_map.find(uid) != m_map.end());
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
-			return result;
-		}
-
-		size_t 
-		_nimble_token_factory::decrement_reference(
-			__in const nimble_uid &uid
-			)
-		{
-			size_t result;
-			std::map<nimble_uid, std::pair<nimble_token, size_t>>::iterator iter;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			iter = find(uid);
-
-			result = --iter->second.second;
-			if(result < REF_INITIAL) {
-				TRACE_MESSAGE(TRACE_INFORMATION, "Removing token: %s", 
-					CHK_STR(nimble_token::as_string(iter->second.first, true)));
-				m_map.erase(iter);
-			}
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		std::map<nimble_uid, std::pair<nimble_token, size_t>>::iterator 
-		_nimble_token_factory::find(
-			__in const nimble_uid &uid
-			)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			std::map<nimble_uid, std::pair<nimble_token, size_t>>::iterator result;
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = m_map.find(uid);
-			if(result == m_map.end()) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_NOT_FOUND),
-					CHK_STR(nimble_uid::as_string(uid)));
-				THROW_NIMBLE_TOKEN_EXCEPTION_MESSAGE(NIMBLE_TOKEN_EXCEPTION_NOT_FOUND,
-					"%s", CHK_STR(nimble_uid::as_string(uid)));
-			}
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
-			return result;
-		}
-
-		nimble_uid 
-		_nimble_token_factory::generate(void)
-		{
-			nimble_token tok;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			TRACE_MESSAGE(TRACE_INFORMATION, "Generating new token: %s", 
-				CHK_STR(tok.to_string(true)));
-			m_map.insert(std::pair<nimble_uid, std::pair<nimble_token, size_t>>(tok.uid(), 
-				std::pair<nimble_token, size_t>(tok, REF_INITIAL)));
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(tok.to_string(true)));
-			return tok.uid();
-		}
-
-		size_t 
-		_nimble_token_factory::increment_reference(
-			__in const nimble_uid &uid
-			)
-		{
-			size_t result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = ++find(uid)->second.second;
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		void 
-		_nimble_token_factory::initialize(void)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_INITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_INITIALIZED);
-			}
-
-			m_initialized = true;
-			m_map.clear();
-			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Token component instance initialized");
-
-			TRACE_EXIT(TRACE_VERBOSE);
-		}
-
 		bool 
 		_nimble_token_factory::is_allocated(void)
 		{
@@ -505,102 +383,5 @@ namespace NIMBLE {
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
 			return result;
 		}
-
-		bool 
-		_nimble_token_factory::is_initialized(void)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", m_initialized);
-			return m_initialized;
-		}
-
-		size_t 
-		_nimble_token_factory::reference_count(
-			__in const nimble_uid &uid
-			)
-		{
-			size_t result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = find(uid)->second.second;
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		size_t 
-		_nimble_token_factory::size(void)
-		{
-			size_t result;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			result = m_map.size();
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
-			return result;
-		}
-
-		std::string 
-		_nimble_token_factory::to_string(
-			__in_opt bool verbose
-			)
-		{
-			std::stringstream result;
-			std::map<nimble_uid, std::pair<nimble_token, size_t>>::iterator iter;
-
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			result << "(" << (m_initialized ? "INIT" : "UNINIT") << ") " << NIMBLE_TOKEN_HEADER 
-				<< "[" << m_map.size() << "]";
-
-			if(verbose) {
-				result << " (" << VAL_AS_HEX(nimble_token_factory_ptr, this) << ")";
-
-				for(iter = m_map.begin(); iter != m_map.end(); ++iter) {
-					result << std::endl << "--- " << nimble_token::as_string(iter->second.first, true)
-						<< ", ref. " << iter->second.second;
-				}
-			}
-
-			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %s", CHK_STR(result.str()));
-			return CHK_STR(result.str());
-		}
-
-		void 
-		_nimble_token_factory::uninitialize(void)
-		{
-			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
-
-			if(!m_initialized) {
-				TRACE_MESSAGE(TRACE_ERROR, "%s", 
-					NIMBLE_TOKEN_EXCEPTION_STRING(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED));
-				THROW_NIMBLE_TOKEN_EXCEPTION(NIMBLE_TOKEN_EXCEPTION_UNINITIALIZED);
-			}
-
-			m_map.clear();
-			m_initialized = false;
-			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Token component instance uninitialized");
-
-			TRACE_EXIT(TRACE_VERBOSE);
-		}
 	}
 }
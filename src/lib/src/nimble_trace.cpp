@@ -17,14 +17,28 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
 #include <ctime>
-#include <cstdarg>
+#include <fcntl.h>
+#include <functional>
+#include <iomanip>
+#include <pthread.h>
+#include <unistd.h>
 #include "../include/nimble.h"
 
 namespace NIMBLE {
 
+	#define NIMBLE_TRACE_HEADER "Trace"
+
 	enum {
 		NIMBLE_TRACE_EXCEPTION_EMPTY = 0,
+		NIMBLE_TRACE_EXCEPTION_FILE_NOT_FOUND,
+		NIMBLE_TRACE_EXCEPTION_INVALID_COMPONENT,
+		NIMBLE_TRACE_EXCEPTION_INVALID_FILE,
+		NIMBLE_TRACE_EXCEPTION_INVALID_LEVEL,
 		NIMBLE_TRACE_EXCEPTION_MALFORMED,
 	};
 
@@ -32,6 +46,10 @@ namespace NIMBLE {
 
 	static const std::string NIMBLE_TRACE_EXCEPTION_STR[] = {
 		"Empty exception",
+		"Trace file not found",
+		"Invalid trace component",
+		"Invalid trace file",
+		"Invalid trace level",
 		"Malformed exception",
 		};
 
@@ -46,105 +64,1314 @@ namespace NIMBLE {
 	#define NIMBLE_TRACE_LEVEL_STRING(_TYPE_) \
 		CHK_STR(NIMBLE_TRACE_LEVEL_STR[((_TYPE_) > NIMBLE_LEVEL_MAX ? 0 : \
 		(_TYPE_))])
-		
+
+	static const std::string NIMBLE_TRACE_COMPONENT_STR[] = {
+		"general", "command", "executor", "factory", "lexer", "parser",
+		};
+
+	#define NIMBLE_TRACE_COMPONENT_STRING(_TYPE_) \
+		((_TYPE_) > TRACE_COMPONENT_MAX ? UNKNOWN : \
+		CHK_STR(NIMBLE_TRACE_COMPONENT_STR[_TYPE_]))
+
+	#define TRACE_BLOCK_RECORD 2
+	#define TRACE_BLOCK_SITE 1
+	#define TRACE_ESCAPE_LEN 8
+	#define TRACE_FILE_INVALID INVALID_TYPE(int)
+	#define TRACE_FILE_MAGIC "NBTRACE"
+	#define TRACE_FILE_MAGIC_LEN 8
+	#define TRACE_FILE_VERSION 1
+	#define TRACE_FLAG_MAX "max"
+	#define TRACE_FLAG_PROFILE "profile"
+	#define TRACE_LEVEL_NONE "none"
+	#define TRACE_LEVEL_WIDTH 10
+	#define TRACE_PROFILE_ENV "NIMBLE_PROFILE"
+	#define TRACE_PROFILE_OFF "off"
+	#define TRACE_PROFILE_ON "on"
+	#define TRACE_PROFILE_SUB (1 << TRACE_PROFILE_SUB_BITS)
+	#define TRACE_PROFILE_WIDTH_COMPONENT 10
+	#define TRACE_PROFILE_WIDTH_NAME 40
+	#define TRACE_PROFILE_WIDTH_VALUE 12
+	#define TRACE_SPEC_CONVERSION "aAcdeEfFgGiopuxX"
+	#define TRACE_SPEC_FLAGS "-+ #0123456789."
+	#define TRACE_SPEC_LENGTH "hljztL"
+	#define TRACE_TIME_FORMAT "%Y-%m-%d %H:%M:%S"
+	#define TRACE_TIME_LEN 64
+
+	typedef struct {
+		char magic[TRACE_FILE_MAGIC_LEN];
+		uint32_t version;
+		uint32_t pid;
+		uint64_t monotonic;
+		int64_t wall;
+	} nimble_trace_file_header;
+
+	typedef struct {
+		uint32_t ring;
+		uint32_t count;
+		uint64_t dropped;
+	} nimble_trace_record_header;
+
+	typedef struct {
+		uint64_t dropped;
+		uint32_t ring;
+		nimble_trace_record record;
+	} nimble_trace_event;
+
+	typedef struct {
+		uint64_t begin;
+		bool dropped;
+		std::string message;
+		uint32_t site;
+	} nimble_trace_span;
+
+	typedef struct {
+		uint64_t begin;
+		nimble_trace_profile *entry;
+		const char *funct;
+	} nimble_trace_frame;
+
+	typedef struct _nimble_trace_ring_guard {
+
+		~_nimble_trace_ring_guard(void)
+		{
+
+			if(ring) {
+				ring->owned.store(false, std::memory_order_release);
+			}
+		}
+
+		nimble_trace_ring *ring;
+	} nimble_trace_ring_guard;
+
+	static thread_local std::vector<nimble_trace_frame> trace_profile_stack;
+
+	static thread_local nimble_trace_ring_guard trace_ring_guard = { NULL };
+
+	int nimble_trace::m_file = TRACE_FILE_INVALID;
+
+	std::thread *nimble_trace::m_flusher = NULL;
+
+	std::atomic<bool> nimble_trace::m_forked(false);
+
 	std::mutex nimble_trace::m_lock;
 
-	bool nimble_trace::m_started = false;
+	std::atomic<uint32_t> nimble_trace::m_mask(0);
 
-	std::ofstream nimble_trace::m_stream;
+	std::string nimble_trace::m_output;
 
-	void 
-	_nimble_trace::generate(
-		__in nimble_lvl_t level,
-		__in const std::string &header,
-		__in const std::string &funct,
-		__in const std::string &source,
-		__in size_t line,
-		__in const char *format,
-		...
+	std::string nimble_trace::m_path;
+
+	std::atomic<bool> nimble_trace::m_pending(false);
+
+	pid_t nimble_trace::m_pid = 0;
+
+	thread_local nimble_trace_ring *nimble_trace::m_ring = NULL;
+
+	size_t nimble_trace::m_site_written = 0;
+
+	std::atomic<bool> nimble_trace::m_started(false);
+
+	template<class T> static void 
+	_append(
+		__inout std::string &buffer,
+		__in const T &value
 		)
 	{
-		std::time_t tm;
-		std::string buf, tmstr;
-		std::stringstream result;
-		SERIALIZE_CALL(m_lock);
+		buffer.append((const char *) &value, sizeof(T));
+	}
+
+	static void 
+	_append_string(
+		__inout std::string &buffer,
+		__in const std::string &value
+		)
+	{
+		_append(buffer, (uint32_t) value.size());
+		buffer.append(value);
+	}
+
+	template<class T> static bool 
+	_extract(
+		__in const std::string &buffer,
+		__inout size_t &position,
+		__out T &value
+		)
+	{
+		bool result = ((position + sizeof(T)) <= buffer.size());
+
+		if(result) {
+			std::memcpy(&value, &buffer[position], sizeof(T));
+			position += sizeof(T);
+		}
+
+		return result;
+	}
+
+	static bool 
+	_extract_string(
+		__in const std::string &buffer,
+		__inout size_t &position,
+		__out std::string &value
+		)
+	{
+		uint32_t length;
+		bool result = _extract(buffer, position, length);
 
-		if(nimble_trace::m_started) {
-			tm = std::time(NULL);
-			tmstr = std::asctime(std::localtime(&tm));
-			result << "[" << tmstr.substr(0, tmstr.size() - 1) << "] ";
+		if(result) {
+			result = ((position + length) <= buffer.size());
+			if(result) {
+				value = buffer.substr(position, length);
+				position += length;
+			}
+		}
+
+		return result;
+	}
+
+	static std::string 
+	_format(
+		__in const nimble_trace_site &site,
+		__in const nimble_trace_record &record
+		)
+	{
+		uint8_t type;
+		double real;
+		std::string spec;
+		uint64_t value = 0;
+		std::string result;
+		char buf[TRACE_RECORD_PAYLOAD + TRACE_TIME_LEN];
+		size_t length, position = 0, payload = 0;
+
+		while(position < site.format.size()) {
 
-			if(!header.empty()) {
-				result << CHK_STR(header);
+			if(site.format.at(position) != '%') {
+				result += site.format.at(position++);
+				continue;
 			}
 
-			if(!funct.empty()) {
-				result << CHK_STR(funct);
+			if(((position + 1) < site.format.size()) && (site.format.at(position + 1) == '%')) {
+				result += '%';
+				position += 2;
+				continue;
+			}
+
+			spec = "%";
+
+			for(++position; (position < site.format.size()) 
+					&& (std::strchr(TRACE_SPEC_FLAGS, site.format.at(position)) != NULL); 
+					++position) {
+				spec += site.format.at(position);
+			}
+
+			while((position < site.format.size()) 
+					&& (std::strchr(TRACE_SPEC_LENGTH, site.format.at(position)) != NULL)) {
+				++position;
+			}
+
+			if(position >= site.format.size()) {
+				result += NIMBLE_TRACE_EXCEPTION_STRING(NIMBLE_TRACE_EXCEPTION_MALFORMED);
+				break;
+			}
+
+			if(payload >= record.length) {
+				result += NIMBLE_TRACE_EXCEPTION_STRING(NIMBLE_TRACE_EXCEPTION_EMPTY);
+				++position;
+				continue;
+			}
+
+			type = record.payload[payload++];
+			if(type == TRACE_ARG_STRING) {
+
+				if((payload >= record.length) 
+						|| ((payload + 1 + record.payload[payload]) > record.length)) {
+					result += NIMBLE_TRACE_EXCEPTION_STRING(NIMBLE_TRACE_EXCEPTION_MALFORMED);
+					break;
+				}
+
+				length = record.payload[payload++];
+				result += std::string((const char *) &record.payload[payload], length);
+				payload += length;
+				++position;
+				continue;
+			}
+
+			if(((payload + sizeof(value)) > record.length) 
+					|| !std::strchr(TRACE_SPEC_CONVERSION, site.format.at(position))) {
+				result += NIMBLE_TRACE_EXCEPTION_STRING(NIMBLE_TRACE_EXCEPTION_MALFORMED);
+				break;
+			}
+
+			std::memcpy(&value, &record.payload[payload], sizeof(value));
+			payload += sizeof(value);
+
+			switch(site.format.at(position)) {
+				case 'a': case 'A': case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+					std::memcpy(&real, &value, sizeof(real));
+					std::snprintf(buf, sizeof(buf), (spec + site.format.at(position)).c_str(), 
+						(type == TRACE_ARG_DOUBLE) ? real : (double) value);
+					break;
+				case 'c':
+					std::snprintf(buf, sizeof(buf), (spec + 'c').c_str(), (int) value);
+					break;
+				case 'p':
+					std::snprintf(buf, sizeof(buf), (spec + "llx").c_str(), 
+						(unsigned long long) value);
+					break;
+				case 'd': case 'i':
+					std::snprintf(buf, sizeof(buf), (spec + "lld").c_str(), (long long) value);
+					break;
+				default:
+					std::snprintf(buf, sizeof(buf), (spec + "ll" + site.format.at(position)).c_str(), 
+						(unsigned long long) value);
+					break;
+			}
+
+			result += buf;
+			++position;
+		}
+
+		if(record.truncated) {
+			result += "...";
+		}
+
+		return result;
+	}
+
+	static std::string 
+	_escape(
+		__in const std::string &value
+		)
+	{
+		char buf[TRACE_ESCAPE_LEN];
+		std::string result;
+		std::string::const_iterator iter;
+
+		for(iter = value.begin(); iter != value.end(); ++iter) {
+
+			switch(*iter) {
+				case '\"':
+				case '\\':
+					result += '\\';
+					result += *iter;
+					break;
+				default:
+
+					if((unsigned char) *iter < ' ') {
+						std::snprintf(buf, sizeof(buf), "\\u%04x", (unsigned char) *iter);
+						result += buf;
+					} else {
+						result += *iter;
+					}
+					break;
+			}
+		}
+
+		return result;
+	}
+
+	static void 
+	_load(
+		__in const std::string &path,
+		__out nimble_trace_file_header &header,
+		__out std::map<uint32_t, nimble_trace_site> &sites,
+		__out std::vector<nimble_trace_event> &events
+		)
+	{
+		uint8_t block;
+		uint64_t line;
+		uint32_t count, level;
+		std::string buffer;
+		nimble_trace_site site;
+		nimble_trace_event event;
+		nimble_trace_record_header record_header;
+		size_t position = 0;
+
+		std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+		if(!file) {
+			THROW_EXCEPTION_MESSAGE(NIMBLE_TRACE_HEADER, NIMBLE_TRACE_EXCEPTION_STRING(
+				NIMBLE_TRACE_EXCEPTION_FILE_NOT_FOUND), "%s", CHK_STR(path));
+		}
+
+		buffer = std::string((std::istreambuf_iterator<char>(file)), 
+			std::istreambuf_iterator<char>());
+
+		if(!_extract(buffer, position, header) 
+				|| std::memcmp(header.magic, TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC))
+				|| (header.version != TRACE_FILE_VERSION)) {
+			THROW_EXCEPTION_MESSAGE(NIMBLE_TRACE_HEADER, NIMBLE_TRACE_EXCEPTION_STRING(
+				NIMBLE_TRACE_EXCEPTION_INVALID_FILE), "%s", CHK_STR(path));
+		}
+
+		while(_extract(buffer, position, block)) {
+
+			if(block == TRACE_BLOCK_SITE) {
+
+				if(!_extract(buffer, position, site.id)
+						|| !_extract(buffer, position, level)
+						|| !_extract(buffer, position, line)
+						|| !_extract(buffer, position, block)
+						|| !_extract_string(buffer, position, site.header)
+						|| !_extract_string(buffer, position, site.funct)
+						|| !_extract_string(buffer, position, site.source)
+						|| !_extract_string(buffer, position, site.format)) {
+					break;
+				}
+
+				if(level > NIMBLE_LEVEL_MAX) {
+					break;
+				}
+
+				site.has_format = block;
+				site.level = (nimble_lvl_t) level;
+				site.line = line;
+				sites[site.id] = site;
+			} else if(block == TRACE_BLOCK_RECORD) {
+
+				if(!_extract(buffer, position, record_header)) {
+					break;
+				}
+
+				event.dropped = 0;
+				event.ring = record_header.ring;
+
+				for(count = 0; count < record_header.count; ++count) {
+
+					if(!_extract(buffer, position, event.record)) {
+						break;
+					}
+
+					if(event.record.length > TRACE_RECORD_PAYLOAD) {
+						event.record.length = TRACE_RECORD_PAYLOAD;
+					}
+
+					events.push_back(event);
+				}
+
+				if(record_header.dropped) {
+					event.dropped = record_header.dropped;
+					events.push_back(event);
+				}
+			} else {
+				THROW_EXCEPTION_MESSAGE(NIMBLE_TRACE_HEADER, NIMBLE_TRACE_EXCEPTION_STRING(
+					NIMBLE_TRACE_EXCEPTION_INVALID_FILE), "%s, block. %u", CHK_STR(path), block);
 			}
+		}
+	}
+
+	static size_t 
+	_profile_index(
+		__in uint64_t value
+		)
+	{
+		size_t msb, result = value;
+
+		if(value >= TRACE_PROFILE_SUB) {
+			msb = ((sizeof(unsigned long long) * 8) - 1 - __builtin_clzll(value));
+			result = (((msb - TRACE_PROFILE_SUB_BITS + 1) << TRACE_PROFILE_SUB_BITS) 
+				+ ((value >> (msb - TRACE_PROFILE_SUB_BITS)) & (TRACE_PROFILE_SUB - 1)));
+		}
+
+		return result;
+	}
 
-			if(format) {
-				va_list lst;
-				va_start(lst, format);
+	static uint64_t 
+	_profile_percentile(
+		__in const nimble_trace_profile &entry,
+		__in uint64_t count,
+		__in double percentile
+		)
+	{
+		size_t index = 0, shift;
+		uint64_t result = 0, seen = 0, target;
+
+		target = (uint64_t) std::ceil(count * percentile);
+
+		for(; index < TRACE_PROFILE_BUCKETS; ++index) {
+			seen += entry.bucket[index].load(std::memory_order_relaxed);
 
-				int len = vsnprintf(NULL, 0, format, lst);
-				if(len < 0) {
-					buf = NIMBLE_TRACE_EXCEPTION_STRING(
-						NIMBLE_TRACE_EXCEPTION_MALFORMED);
-				} else if(!len) {
-					buf = NIMBLE_TRACE_EXCEPTION_STRING(
-						NIMBLE_TRACE_EXCEPTION_EMPTY);
+			if(seen >= target) {
+
+				if(index < TRACE_PROFILE_SUB) {
+					result = index;
 				} else {
-					va_end(lst);
-					va_start(lst, format);
-					buf.resize(++len, '\0');
-
-					len = vsnprintf((char *) &buf[0], len, format, lst);
-					if(len < 0) {
-						buf = NIMBLE_TRACE_EXCEPTION_STRING(
-							NIMBLE_TRACE_EXCEPTION_MALFORMED);
-					} else if(!len) {
-						buf = NIMBLE_TRACE_EXCEPTION_STRING(
-							NIMBLE_TRACE_EXCEPTION_EMPTY);
+					shift = ((index >> TRACE_PROFILE_SUB_BITS) - 1);
+					result = ((((uint64_t) (TRACE_PROFILE_SUB + (index & (TRACE_PROFILE_SUB - 1)) 
+						+ 1)) << shift) - 1);
+				}
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	static std::string 
+	_timestamp(
+		__in const nimble_trace_file_header &header,
+		__in uint64_t time
+		)
+	{
+		int64_t offset;
+		std::stringstream result;
+
+		offset = (header.wall + (int64_t) (time - header.monotonic));
+		result << (offset / 1000) << "." << std::setw(3) << std::setfill('0') 
+			<< (offset % 1000);
+
+		return result.str();
+	}
+
+	static void 
+	_write_span(
+		__out std::ostream &stream,
+		__in const nimble_trace_file_header &header,
+		__in std::map<uint32_t, nimble_trace_site> &sites,
+		__in uint32_t ring,
+		__in const nimble_trace_span &span,
+		__in uint64_t end,
+		__in const std::string &message
+		)
+	{
+		nimble_trace_site &site = sites[span.site];
+
+		stream << "," << std::endl << "{\"name\":\"" << _escape(site.funct) << "\",\"cat\":\"" 
+			<< nimble_trace::component_as_string(nimble_trace::component(site.source.c_str())) 
+			<< "\",\"ph\":\"X\",\"ts\":" << _timestamp(header, span.begin) << ",\"dur\":" 
+			<< ((end - span.begin) / 1000) << "." << std::setw(3) << std::setfill('0') 
+			<< ((end - span.begin) % 1000) << std::setfill(' ') << ",\"pid\":" << header.pid 
+			<< ",\"tid\":" << ring << ",\"args\":{\"source\":\"" << _escape(site.source) << ":" 
+			<< site.line << "\"";
+
+		if(!span.message.empty()) {
+			stream << ",\"entry\":\"" << _escape(span.message) << "\"";
+		}
+
+		if(!message.empty()) {
+			stream << ",\"exit\":\"" << _escape(message) << "\"";
+		}
+
+		stream << "}}";
+	}
+
+	bool 
+	_nimble_trace::_activate(void)
+	{
+		uint32_t component;
+		bool result = false;
+		std::stringstream loc;
+		nimble_lvl_t level = TRACE_NONE;
+
+		if(m_pending.load(std::memory_order_relaxed)) {
+
+			std::unique_lock<std::mutex> lock(m_lock, std::try_to_lock);
+			if(lock.owns_lock() && m_pending.load(std::memory_order_relaxed)) {
+
+				if(!m_started.load(std::memory_order_relaxed)) {
+
+					for(component = 0; component <= TRACE_COMPONENT_MAX; ++component) {
+						level = std::max(level, nimble_trace::level(component));
+					}
+
+					if(m_forked.exchange(false, std::memory_order_relaxed)) {
+						loc << m_path;
+					} else {
+						loc << m_output << "_" << NIMBLE_TRACE_LEVEL_STRING(level) << "_" 
+							<< std::time(NULL);
+					}
+
+					if(getpid() != m_pid) {
+						loc << "." << getpid();
+					}
+
+					m_path = loc.str();
+					m_file = open(m_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 
+						S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+					if(m_file == TRACE_FILE_INVALID) {
+						m_pending.store(false, std::memory_order_relaxed);
+					} else {
+						m_site_written = 0;
+						_write_header();
+						m_started.store(true, std::memory_order_relaxed);
+						m_flusher = new std::thread(_nimble_trace::_run);
 					}
 				}
 
-				va_end(lst);
+				result = m_started.load(std::memory_order_relaxed);
+			}
+		}
+
+		return result;
+	}
 
-				if(!buf.empty()) {
-					result << ": " << CHK_STR(buf);
+	void 
+	_nimble_trace::_commit(void)
+	{
+		m_ring->head.store(m_ring->head.load(std::memory_order_relaxed) + 1, 
+			std::memory_order_release);
+	}
+
+	void 
+	_nimble_trace::_encode(
+		__inout nimble_trace_record &record,
+		__in const char *value
+		)
+	{
+		size_t length;
+
+		if(!value) {
+			value = "(null)";
+		}
+
+		length = std::strlen(value);
+		if((record.length + (2 * sizeof(uint8_t))) > TRACE_RECORD_PAYLOAD) {
+			record.truncated = 1;
+		} else {
+
+			if(length > (TRACE_RECORD_PAYLOAD - record.length - (2 * sizeof(uint8_t)))) {
+				length = (TRACE_RECORD_PAYLOAD - record.length - (2 * sizeof(uint8_t)));
+				record.truncated = 1;
+			}
+
+			record.payload[record.length++] = TRACE_ARG_STRING;
+			record.payload[record.length++] = length;
+			std::memcpy(&record.payload[record.length], value, length);
+			record.length += length;
+		}
+	}
+
+	void 
+	_nimble_trace::_encode(
+		__inout nimble_trace_record &record,
+		__in const std::string &value
+		)
+	{
+		_encode(record, value.c_str());
+	}
+
+	void 
+	_nimble_trace::_encode(
+		__inout nimble_trace_record &record,
+		__in double value
+		)
+	{
+		_encode_value(record, TRACE_ARG_DOUBLE, value);
+	}
+
+	void 
+	_nimble_trace::_encode_arguments(
+		__inout nimble_trace_record &record
+		)
+	{
+		REF_PARAM(record);
+	}
+
+	void 
+	_nimble_trace::_flush(void)
+	{
+		uint64_t head, tail;
+		std::string records, sites;
+		nimble_trace_record_header header;
+		std::vector<nimble_trace_ring *>::iterator iter;
+
+		for(iter = _ring_list().begin(); iter != _ring_list().end(); ++iter) {
+			tail = (*iter)->tail.load(std::memory_order_relaxed);
+			head = (*iter)->head.load(std::memory_order_acquire);
+			header.count = (head - tail);
+			header.dropped = (*iter)->dropped.exchange(0, std::memory_order_relaxed);
+			header.ring = (*iter)->id;
+
+			if(header.count || header.dropped) {
+				_append(records, (uint8_t) TRACE_BLOCK_RECORD);
+				_append(records, header);
+
+				for(; tail != head; ++tail) {
+					_append(records, (*iter)->slot[tail % TRACE_RING_SLOTS]);
 				}
+
+				(*iter)->tail.store(head, std::memory_order_release);
 			}
+		}
+
+		for(; m_site_written < _site_list().size(); ++m_site_written) {
+			nimble_trace_site &site = _site_list().at(m_site_written);
+			_append(sites, (uint8_t) TRACE_BLOCK_SITE);
+			_append(sites, site.id);
+			_append(sites, (uint32_t) site.level);
+			_append(sites, (uint64_t) site.line);
+			_append(sites, (uint8_t) site.has_format);
+			_append_string(sites, site.header);
+			_append_string(sites, site.funct);
+			_append_string(sites, site.source);
+			_append_string(sites, site.format);
+		}
+
+		if(!sites.empty() || !records.empty()) {
+			_write(sites + records);
+		}
+	}
+
+	void 
+	_nimble_trace::_fork_child(void)
+	{
+		std::vector<nimble_trace_ring *>::iterator iter;
 
-			result << " (";
+		new (&m_lock) std::mutex;
 
-			if(!source.empty()) {
-				result << source << ":";
+		if(is_profiling()) {
+			profile_reset();
+		}
+
+		if(m_started.load(std::memory_order_relaxed)) {
+			m_flusher = NULL;
+
+			for(iter = _ring_list().begin(); iter != _ring_list().end(); ++iter) {
+				(*iter)->tail.store((*iter)->head.load(std::memory_order_relaxed), 
+					std::memory_order_relaxed);
+				(*iter)->dropped.store(0, std::memory_order_relaxed);
 			}
 
-			result << line << ")";
+			close(m_file);
+			m_file = TRACE_FILE_INVALID;
+			m_forked.store(true, std::memory_order_relaxed);
+			m_started.store(false, std::memory_order_relaxed);
+			m_pending.store(true, std::memory_order_relaxed);
+		}
+	}
 
-			switch(level) {
-				case TRACE_ERROR:
-					SET_TERM_ATTRIB(nimble_trace::m_stream, 1, COL_FORE_RED);
-					nimble_trace::m_stream << CHK_STR(result.str()) << std::endl;
-					CLEAR_TERM_ATTRIB(nimble_trace::m_stream);
-					break;
-				case TRACE_WARNING:
-					SET_TERM_ATTRIB(nimble_trace::m_stream, 1, COL_FORE_YELLOW);
-					nimble_trace::m_stream << CHK_STR(result.str()) << std::endl;
-					CLEAR_TERM_ATTRIB(nimble_trace::m_stream);
-					break;
-				default:
-					nimble_trace::m_stream << CHK_STR(result.str()) << std::endl;
+	uint64_t 
+	_nimble_trace::_now(void)
+	{
+		struct timespec now;
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		return ((now.tv_sec * 1000000000ULL) + now.tv_nsec);
+	}
+
+	nimble_trace_record *
+	_nimble_trace::_reserve(void)
+	{
+		uint64_t head;
+		void *memory = NULL;
+		nimble_trace_record *result = NULL;
+		std::vector<nimble_trace_ring *>::iterator iter;
+
+		if(!m_ring) {
+			std::lock_guard<std::mutex> lock(m_lock);
+
+			for(iter = _ring_list().begin(); iter != _ring_list().end(); ++iter) {
+				bool owned = false;
+
+				if((*iter)->owned.compare_exchange_strong(owned, true, 
+						std::memory_order_acquire)) {
+					m_ring = *iter;
 					break;
+				}
+			}
+
+			if(!m_ring) {
+
+				if(posix_memalign(&memory, TRACE_RING_LINE, sizeof(nimble_trace_ring))) {
+					return result;
+				}
+
+				m_ring = new (memory) nimble_trace_ring;
+				m_ring->dropped.store(0, std::memory_order_relaxed);
+				m_ring->head.store(0, std::memory_order_relaxed);
+				m_ring->id = _ring_list().size();
+				m_ring->owned.store(true, std::memory_order_relaxed);
+				m_ring->tail.store(0, std::memory_order_relaxed);
+				_ring_list().push_back(m_ring);
+			}
+
+			trace_ring_guard.ring = m_ring;
+		}
+
+		head = m_ring->head.load(std::memory_order_relaxed);
+		if((head - m_ring->tail.load(std::memory_order_acquire)) >= TRACE_RING_SLOTS) {
+			m_ring->dropped.fetch_add(1, std::memory_order_relaxed);
+		} else {
+			result = &m_ring->slot[head % TRACE_RING_SLOTS];
+		}
+
+		return result;
+	}
+
+	std::vector<nimble_trace_profile *> &
+	_nimble_trace::_profile_list(void)
+	{
+		static std::vector<nimble_trace_profile *> *result = new std::vector<nimble_trace_profile *>;
+
+		return *result;
+	}
+
+	std::vector<nimble_trace_ring *> &
+	_nimble_trace::_ring_list(void)
+	{
+		static std::vector<nimble_trace_ring *> *result = new std::vector<nimble_trace_ring *>;
+
+		return *result;
+	}
+
+	void 
+	_nimble_trace::_run(void)
+	{
+
+		while(m_started.load(std::memory_order_relaxed)) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(TRACE_FLUSH_INTERVAL));
+			std::lock_guard<std::mutex> lock(m_lock);
+
+			if(m_started.load(std::memory_order_relaxed)) {
+				_flush();
+			}
+		}
+	}
+
+	std::vector<nimble_trace_site> &
+	_nimble_trace::_site_list(void)
+	{
+		static std::vector<nimble_trace_site> *result = new std::vector<nimble_trace_site>;
+
+		return *result;
+	}
+
+	void 
+	_nimble_trace::_write(
+		__in const std::string &buffer
+		)
+	{
+		ssize_t length;
+		size_t position = 0;
+
+		while(position < buffer.size()) {
+
+			length = write(m_file, &buffer[position], buffer.size() - position);
+			if(length < 0) {
+
+				if(errno == EINTR) {
+					continue;
+				}
+
+				break;
+			}
+
+			position += length;
+		}
+	}
+
+	void 
+	_nimble_trace::_write_header(void)
+	{
+		std::string buffer;
+		nimble_trace_file_header header;
+
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+		header.monotonic = _now();
+		header.pid = getpid();
+		header.version = TRACE_FILE_VERSION;
+		header.wall = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+		_append(buffer, header);
+		_write(buffer);
+	}
+
+	uint32_t 
+	_nimble_trace::component(
+		__in const std::string &name
+		)
+	{
+		uint32_t result = 0;
+
+		for(; result <= TRACE_COMPONENT_MAX; ++result) {
+
+			if(name == NIMBLE_TRACE_COMPONENT_STR[result]) {
+				break;
 			}
 		}
+
+		if(result > TRACE_COMPONENT_MAX) {
+			THROW_EXCEPTION_MESSAGE(NIMBLE_TRACE_HEADER, NIMBLE_TRACE_EXCEPTION_STRING(
+				NIMBLE_TRACE_EXCEPTION_INVALID_COMPONENT), "%s", CHK_STR(name));
+		}
+
+		return result;
+	}
+
+	std::string 
+	_nimble_trace::component_as_string(
+		__in uint32_t component
+		)
+	{
+		return NIMBLE_TRACE_COMPONENT_STRING(component);
+	}
+
+	void 
+	_nimble_trace::decode(
+		__in const std::string &path,
+		__out std::ostream &stream
+		)
+	{
+		std::time_t tm;
+		int64_t offset;
+		nimble_trace_file_header header;
+		char tmstr[TRACE_TIME_LEN];
+		std::vector<nimble_trace_event> events;
+		std::vector<nimble_trace_event>::iterator event;
+		std::map<uint32_t, nimble_trace_site> sites;
+		std::map<uint32_t, nimble_trace_site>::iterator iter;
+
+		_load(path, header, sites, events);
+
+		for(event = events.begin(); event != events.end(); ++event) {
+
+			if(event->dropped) {
+				stream << "[" << header.pid << ":" << event->ring << "] " 
+					<< event->dropped << " records dropped" << std::endl;
+				continue;
+			}
+
+			offset = (header.wall + (int64_t) (event->record.time - header.monotonic));
+			tm = (offset / 1000000000LL);
+			std::strftime(tmstr, sizeof(tmstr), TRACE_TIME_FORMAT, std::localtime(&tm));
+			stream << "[" << tmstr << "." << std::setw(9) << std::setfill('0') 
+				<< (offset % 1000000000LL) << std::setfill(' ') << "] [" << header.pid 
+				<< ":" << event->ring << "] ";
+
+			iter = sites.find(event->record.site);
+			if(iter == sites.end()) {
+				stream << "(site " << event->record.site << ")" << std::endl;
+				continue;
+			}
+
+			stream << NIMBLE_TRACE_LEVEL_STRING(iter->second.level) << " " 
+				<< iter->second.header << iter->second.funct;
+
+			if(iter->second.has_format) {
+				stream << ": " << _format(iter->second, event->record);
+			}
+
+			stream << " (" << iter->second.source << ":" << iter->second.line << ")" 
+				<< std::endl;
+		}
+	}
+
+	void 
+	_nimble_trace::export_chrome(
+		__in const std::vector<std::string> &path,
+		__out std::ostream &stream
+		)
+	{
+		uint64_t end;
+		bool first = true;
+		nimble_trace_span span;
+		nimble_trace_file_header header;
+		std::vector<nimble_trace_event> events;
+		std::vector<nimble_trace_event>::iterator event;
+		std::vector<std::string>::const_iterator path_iter;
+		std::map<uint32_t, uint64_t> last;
+		std::map<uint32_t, nimble_trace_site> sites;
+		std::map<uint32_t, nimble_trace_site>::iterator iter;
+		std::map<uint32_t, std::vector<nimble_trace_span>> open;
+		std::map<uint32_t, std::vector<nimble_trace_span>>::iterator open_iter;
+		std::vector<nimble_trace_span>::iterator span_iter;
+
+		stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+		for(path_iter = path.begin(); path_iter != path.end(); ++path_iter) {
+			events.clear();
+			last.clear();
+			open.clear();
+			sites.clear();
+			_load(*path_iter, header, sites, events);
+			stream << (first ? "" : ",") << std::endl << "{\"name\":\"process_name\",\"ph\":\"M\","
+				<< "\"pid\":" << header.pid << ",\"args\":{\"name\":\"nimble " << header.pid 
+				<< "\"}}";
+			first = false;
+
+			for(event = events.begin(); event != events.end(); ++event) {
+
+				if(event->dropped) {
+
+					for(span_iter = open[event->ring].begin(); span_iter != open[event->ring].end(); 
+							++span_iter) {
+						span_iter->dropped = true;
+					}
+
+					stream << "," << std::endl << "{\"name\":\"dropped\",\"ph\":\"i\",\"s\":\"t\","
+						<< "\"ts\":" << _timestamp(header, last[event->ring]) << ",\"pid\":" 
+						<< header.pid << ",\"tid\":" << event->ring << ",\"args\":{\"count\":" 
+						<< event->dropped << "}}";
+					continue;
+				}
+
+				last[event->ring] = event->record.time;
+
+				iter = sites.find(event->record.site);
+				if(iter == sites.end()) {
+					continue;
+				}
+
+				span.begin = event->record.time;
+				span.dropped = false;
+				span.message = (iter->second.has_format ? _format(iter->second, event->record) 
+					: std::string());
+				span.site = event->record.site;
+				std::vector<nimble_trace_span> &stack = open[event->ring];
+
+				if(iter->second.header == TRACE_HEADER_ENTRY) {
+					stack.push_back(span);
+				} else if(iter->second.header == TRACE_HEADER_EXIT) {
+
+					for(end = stack.size(); end; --end) {
+
+						if(sites[stack.at(end - 1).site].funct == iter->second.funct) {
+							break;
+						}
+					}
+
+					for(; end && (stack.size() >= end); stack.pop_back()) {
+
+						if((stack.size() == end) || !stack.back().dropped) {
+							_write_span(stream, header, sites, event->ring, stack.back(), 
+								event->record.time, (stack.size() == end) ? span.message 
+									: std::string());
+						}
+					}
+				} else {
+					stream << "," << std::endl << "{\"name\":\"" << _escape(iter->second.funct) 
+						<< "\",\"cat\":\"" << component_as_string(component(
+							iter->second.source.c_str())) << "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" 
+						<< _timestamp(header, span.begin) << ",\"pid\":" << header.pid 
+						<< ",\"tid\":" << event->ring << ",\"args\":{\"message\":\"" 
+						<< _escape(span.message) << "\"}}";
+				}
+			}
+
+			for(open_iter = open.begin(); open_iter != open.end(); ++open_iter) {
+
+				for(; !open_iter->second.empty(); open_iter->second.pop_back()) {
+
+					if(!open_iter->second.back().dropped) {
+						_write_span(stream, header, sites, open_iter->first, 
+							open_iter->second.back(), last[open_iter->first], std::string());
+					}
+				}
+			}
+		}
+
+		stream << std::endl << "]}" << std::endl;
+	}
+
+	void 
+	_nimble_trace::flush(void)
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if(m_started.load(std::memory_order_relaxed)) {
+			_flush();
+		}
+	}
+
+	bool 
+	_nimble_trace::is_profiling(void)
+	{
+		return is_enabled(TRACE_MASK_PROFILE);
 	}
 
 	bool 
 	_nimble_trace::is_started(void)
 	{
-		return (nimble_trace::m_started);
+		return m_started.load(std::memory_order_relaxed);
+	}
+
+	nimble_lvl_t 
+	_nimble_trace::level(
+		__in_opt uint32_t component
+		)
+	{
+		uint32_t mask = m_mask.load(std::memory_order_relaxed);
+		nimble_lvl_t result = NIMBLE_LEVEL_MAX;
+
+		if(component > TRACE_COMPONENT_MAX) {
+			return TRACE_NONE;
+		}
+
+		for(; result > TRACE_NONE; result = (nimble_lvl_t) (result - 1)) {
+
+			if(mask & TRACE_MASK_BIT(component, result)) {
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	nimble_lvl_t 
+	_nimble_trace::level(
+		__in const std::string &name
+		)
+	{
+		uint32_t result = TRACE_NONE + 1;
+
+		if(name != TRACE_LEVEL_NONE) {
+
+			for(; result <= NIMBLE_LEVEL_MAX; ++result) {
+
+				if(name == NIMBLE_TRACE_LEVEL_STR[result]) {
+					break;
+				}
+			}
+
+			if(result > NIMBLE_LEVEL_MAX) {
+				THROW_EXCEPTION_MESSAGE(NIMBLE_TRACE_HEADER, NIMBLE_TRACE_EXCEPTION_STRING(
+					NIMBLE_TRACE_EXCEPTION_INVALID_LEVEL), "%s", CHK_STR(name));
+			}
+		} else {
+			result = TRACE_NONE;
+		}
+
+		return (nimble_lvl_t) result;
+	}
+
+	std::string 
+	_nimble_trace::level_as_string(void)
+	{
+		uint32_t component = 0;
+		nimble_lvl_t level;
+		std::stringstream result;
+
+		for(; component <= TRACE_COMPONENT_MAX; ++component) {
+			level = nimble_trace::level(component);
+
+			if(component) {
+				result << std::endl;
+			}
+
+			result << std::left << std::setw(TRACE_LEVEL_WIDTH) 
+				<< NIMBLE_TRACE_COMPONENT_STRING(component) 
+				<< ((level == TRACE_NONE) ? TRACE_LEVEL_NONE : NIMBLE_TRACE_LEVEL_STRING(level));
+		}
+
+		level = level_max();
+		result << std::endl << std::left << std::setw(TRACE_LEVEL_WIDTH) << TRACE_FLAG_MAX 
+			<< ((level == TRACE_NONE) ? TRACE_LEVEL_NONE : NIMBLE_TRACE_LEVEL_STRING(level));
+		result << std::endl << std::left << std::setw(TRACE_LEVEL_WIDTH) << TRACE_FLAG_PROFILE 
+			<< (is_profiling() ? TRACE_PROFILE_ON : TRACE_PROFILE_OFF);
+
+		if(m_started.load(std::memory_order_relaxed)) {
+			result << std::endl << "(" << m_path << ")";
+		}
+
+		return result.str();
+	}
+
+	nimble_lvl_t 
+	_nimble_trace::level_max(void)
+	{
+		return (nimble_lvl_t) TRACE_LEVEL_MAX;
+	}
+
+	void 
+	_nimble_trace::profile(
+		__in nimble_trace_profile *entry,
+		__in const char *funct
+		)
+	{
+		nimble_trace_frame frame;
+		size_t position = trace_profile_stack.size();
+		uint64_t elapsed, max;
+
+		if(entry) {
+			frame.begin = _now();
+			frame.entry = entry;
+			frame.funct = funct;
+			trace_profile_stack.push_back(frame);
+		} else {
+
+			for(; position; --position) {
+
+				if(trace_profile_stack.at(position - 1).funct == funct) {
+					break;
+				}
+			}
+
+			if(position) {
+				frame = trace_profile_stack.at(position - 1);
+				trace_profile_stack.resize(position - 1);
+				elapsed = (_now() - frame.begin);
+				frame.entry->bucket[_profile_index(elapsed)].fetch_add(1, 
+					std::memory_order_relaxed);
+				frame.entry->count.fetch_add(1, std::memory_order_relaxed);
+				frame.entry->total.fetch_add(elapsed, std::memory_order_relaxed);
+
+				max = frame.entry->max.load(std::memory_order_relaxed);
+				while((elapsed > max) && !frame.entry->max.compare_exchange_weak(max, elapsed, 
+						std::memory_order_relaxed));
+			}
+		}
+	}
+
+	std::string 
+	_nimble_trace::profile_as_string(void)
+	{
+		uint64_t count;
+		std::stringstream result;
+		std::lock_guard<std::mutex> lock(m_lock);
+		std::vector<std::pair<uint64_t, nimble_trace_profile *>> entry;
+		std::vector<std::pair<uint64_t, nimble_trace_profile *>>::iterator iter;
+		std::vector<nimble_trace_profile *>::iterator profile_iter;
+
+		for(profile_iter = _profile_list().begin(); profile_iter != _profile_list().end(); 
+				++profile_iter) {
+
+			if((*profile_iter)->count.load(std::memory_order_relaxed)) {
+				entry.push_back(std::pair<uint64_t, nimble_trace_profile *>(
+					(*profile_iter)->total.load(std::memory_order_relaxed), *profile_iter));
+			}
+		}
+
+		std::sort(entry.begin(), entry.end(), 
+			std::greater<std::pair<uint64_t, nimble_trace_profile *>>());
+		result << std::left << std::setw(TRACE_PROFILE_WIDTH_NAME) << "FUNCTION" << " "
+			<< std::setw(TRACE_PROFILE_WIDTH_COMPONENT) << "COMPONENT" << std::right
+			<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << "CALLS"
+			<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << "TOTAL(MS)"
+			<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << "MEAN(NS)"
+			<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << "P50(NS)"
+			<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << "P99(NS)"
+			<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << "MAX(NS)";
+
+		for(iter = entry.begin(); iter != entry.end(); ++iter) {
+			nimble_trace_site &site = _site_list().at(iter->second->site);
+			count = iter->second->count.load(std::memory_order_relaxed);
+			result << std::endl << std::left << std::setw(TRACE_PROFILE_WIDTH_NAME) 
+				<< (site.funct + " (" + site.source.substr(site.source.find_last_of("/\\") + 1) 
+					+ ":" + std::to_string(site.line) + ")") << " "
+				<< std::setw(TRACE_PROFILE_WIDTH_COMPONENT) 
+				<< NIMBLE_TRACE_COMPONENT_STRING(component(site.source.c_str())) << std::right
+				<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << count
+				<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << std::fixed << std::setprecision(3) 
+					<< (iter->first / 1000000.0)
+				<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << (iter->first / count)
+				<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << _profile_percentile(*iter->second, 
+					count, 0.5)
+				<< std::setw(TRACE_PROFILE_WIDTH_VALUE) << _profile_percentile(*iter->second, 
+					count, 0.99)
+				<< std::setw(TRACE_PROFILE_WIDTH_VALUE) 
+					<< iter->second->max.load(std::memory_order_relaxed);
+		}
+
+		return result.str();
+	}
+
+	void 
+	_nimble_trace::profile_reset(void)
+	{
+		size_t index;
+		std::lock_guard<std::mutex> lock(m_lock);
+		std::vector<nimble_trace_profile *>::iterator iter;
+
+		for(iter = _profile_list().begin(); iter != _profile_list().end(); ++iter) {
+
+			for(index = 0; index < TRACE_PROFILE_BUCKETS; ++index) {
+				(*iter)->bucket[index].store(0, std::memory_order_relaxed);
+			}
+
+			(*iter)->count.store(0, std::memory_order_relaxed);
+			(*iter)->max.store(0, std::memory_order_relaxed);
+			(*iter)->total.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	nimble_trace_profile *
+	_nimble_trace::profile_site(
+		__in uint32_t site,
+		__in uint32_t type
+		)
+	{
+		nimble_trace_profile *result = NULL;
+
+		if(type == TRACE_PROFILE_ENTRY) {
+			std::lock_guard<std::mutex> lock(m_lock);
+
+			result = new nimble_trace_profile();
+			result->site = site;
+			_profile_list().push_back(result);
+		}
+
+		return result;
+	}
+
+	void 
+	_nimble_trace::set_level(
+		__in nimble_lvl_t level,
+		__in_opt uint32_t component
+		)
+	{
+		uint32_t bits = 0, clear = 0, current, entry, mask;
+
+		if(level > level_max()) {
+			level = level_max();
+		}
+
+		for(entry = 0; entry <= TRACE_COMPONENT_MAX; ++entry) {
+
+			if((component == TRACE_COMPONENT_ALL) || (component == entry)) {
+
+				for(current = TRACE_NONE + 1; current <= NIMBLE_LEVEL_MAX; ++current) {
+					clear |= TRACE_MASK_BIT(entry, current);
+
+					if(current <= (uint32_t) level) {
+						bits |= TRACE_MASK_BIT(entry, current);
+					}
+				}
+			}
+		}
+
+		mask = m_mask.load(std::memory_order_relaxed);
+		while(!m_mask.compare_exchange_weak(mask, (mask & ~clear) | bits, 
+				std::memory_order_relaxed));
+	}
+
+	void 
+	_nimble_trace::set_profile(
+		__in bool enabled
+		)
+	{
+
+		if(enabled) {
+			m_mask.fetch_or(TRACE_MASK_PROFILE, std::memory_order_relaxed);
+		} else {
+			m_mask.fetch_and(~TRACE_MASK_PROFILE, std::memory_order_relaxed);
+		}
+	}
+
+	uint32_t 
+	_nimble_trace::site(
+		__in nimble_lvl_t level,
+		__in const char *header,
+		__in const char *funct,
+		__in const char *source,
+		__in size_t line,
+		__in const char *format
+		)
+	{
+		nimble_trace_site entry;
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		entry.format = (format ? format : std::string());
+		entry.funct = (funct ? funct : std::string());
+		entry.has_format = (format != NULL);
+		entry.header = (header ? header : std::string());
+		entry.id = _site_list().size();
+		entry.level = level;
+		entry.line = line;
+		entry.source = (source ? source : std::string());
+		_site_list().push_back(entry);
+
+		return entry.id;
 	}
 
 	void 
@@ -154,18 +1381,25 @@ namespace NIMBLE {
 		__in const std::string &output
 		)
 	{
-		std::time_t tm;
-		std::stringstream loc;
+		static bool registered = false;
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if(!m_started.load(std::memory_order_relaxed)) {
+
+			if(!registered) {
+				pthread_atfork(NULL, NULL, _nimble_trace::_fork_child);
+				std::atexit(_nimble_trace::stop);
+				registered = true;
+			}
 
-		if(!nimble_trace::m_started) {
-			std::time(&tm);
-			loc << path << "/" << output << "_" << NIMBLE_TRACE_LEVEL_STRING(level) 
-				<< "_" << tm;
-			nimble_trace::m_stream = std::ofstream(loc.str().c_str(), 
-				std::ios::out | std::ios::trunc);
+			m_forked.store(false, std::memory_order_relaxed);
+			m_output = (path + "/" + output);
+			m_pid = getpid();
+			m_pending.store(true, std::memory_order_relaxed);
+			set_level(level);
 
-			if(nimble_trace::m_stream) {
-				nimble_trace::m_started = true;
+			if(std::getenv(TRACE_PROFILE_ENV) && (level_max() >= TRACE_LEVEL_PROFILE)) {
+				set_profile(true);
 			}
 		}
 	}
@@ -173,14 +1407,40 @@ namespace NIMBLE {
 	void 
 	_nimble_trace::stop(void)
 	{
+		std::thread *flusher = NULL;
+		const char *path = std::getenv(TRACE_PROFILE_ENV);
 
-		if(nimble_trace::m_started) {
+		if(path && is_profiling()) {
+			set_profile(false);
 
-			if(nimble_trace::m_stream) {
-				nimble_trace::m_stream.close();
+			std::ofstream file(path, std::ios::out | std::ios::app);
+			if(file) {
+				file << "pid " << getpid() << std::endl << profile_as_string() << std::endl 
+					<< std::endl;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+
+			m_pending.store(false, std::memory_order_relaxed);
+			if(!m_started.load(std::memory_order_relaxed)) {
+				return;
 			}
 
-			nimble_trace::m_started = false;
+			m_started.store(false, std::memory_order_relaxed);
+			flusher = m_flusher;
+			m_flusher = NULL;
 		}
+
+		if(flusher) {
+			flusher->join();
+			delete flusher;
+		}
+
+		std::lock_guard<std::mutex> lock(m_lock);
+		_flush();
+		close(m_file);
+		m_file = TRACE_FILE_INVALID;
 	}
 }
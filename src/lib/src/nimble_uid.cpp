@@ -54,7 +54,6 @@ namespace NIMBLE {
 			)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 		
 			if(this != &other) {
 				m_uid = other.m_uid;
@@ -73,7 +72,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_uid == other.m_uid);
 
@@ -89,7 +87,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_uid != other.m_uid);
 
@@ -128,7 +125,6 @@ namespace NIMBLE {
 			bool result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = (m_uid != UID_INVALID);
 
@@ -144,7 +140,6 @@ namespace NIMBLE {
 			std::string result;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			result = nimble_uid::as_string(*this, verbose);
 
@@ -156,7 +151,14 @@ namespace NIMBLE {
 		_nimble_uid::uid(void)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
+			return m_uid;
+		}
+
+		nimble_uid_t 
+		_nimble_uid::uid(void) const
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", m_uid);
 			return m_uid;
 		}
 
@@ -179,7 +181,9 @@ namespace NIMBLE {
 		nimble_uid_factory_ptr nimble_uid_factory::m_instance = NULL;
 
 		_nimble_uid_factory::_nimble_uid_factory(void) :
-			m_initialized(false)
+			m_free(UID_SLOT_INVALID),
+			m_initialized(false),
+			m_size(0)
 		{
 			TRACE_ENTRY(TRACE_VERBOSE);
 
@@ -256,7 +260,9 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = (m_map.find(uid) != m_map.end());
+			result = ((UID_INDEX(uid.m_uid) < m_slot.size())
+					&& (m_slot[UID_INDEX(uid.m_uid)].reference >= REF_INITIAL)
+					&& (m_slot[UID_INDEX(uid.m_uid)].generation == UID_GENERATION(uid.m_uid)));
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. 0x%x", result);
 			return result;
@@ -268,7 +274,7 @@ namespace NIMBLE {
 			)
 		{
 			size_t result;
-			std::map<nimble_uid, size_t>::iterator iter;
+			nimble_uid_slot *slot = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -279,26 +285,30 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			iter = find(uid);
+			slot = &find(uid);
 
-			result = --iter->second;
+			result = --slot->reference;
 			if(result < REF_INITIAL) {
 				TRACE_MESSAGE(TRACE_INFORMATION, "Removing uid: %s", 
 					CHK_STR(nimble_uid::as_string(uid, true)));
-				m_surplus.insert(iter->first);
-				m_map.erase(iter);
+				++slot->generation;
+				slot->next = m_free;
+				m_free = UID_INDEX(uid.m_uid);
+				--m_size;
+				m_stats.release();
 			}
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
 		}
 
-		std::map<nimble_uid, size_t>::iterator 
+		_nimble_uid_factory::nimble_uid_slot &
 		_nimble_uid_factory::find(
 			__in const nimble_uid &uid
 			)
 		{
-			std::map<nimble_uid, size_t>::iterator result;
+			nimble_uid_slot *result = NULL;
+			uint32_t index = UID_INDEX(uid.m_uid);
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -309,17 +319,27 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_map.find(uid);
-			if(result == m_map.end()) {
+			if(index >= m_slot.size()) {
 				TRACE_MESSAGE(TRACE_ERROR, "%s, %s", 
-					NIMBLE_UID_EXCEPTION_STRING(NIMBLE_UID_EXCEPTION_UNINITIALIZED),
+					NIMBLE_UID_EXCEPTION_STRING(NIMBLE_UID_EXCEPTION_NOT_FOUND),
 					 CHK_STR(nimble_uid::as_string(uid)));
 				THROW_NIMBLE_UID_EXCEPTION_MESSAGE(NIMBLE_UID_EXCEPTION_NOT_FOUND,
 					"%s", CHK_STR(nimble_uid::as_string(uid)));
 			}
 
+			result = &m_slot[index];
+			if((result->reference < REF_INITIAL)
+					|| (result->generation != UID_GENERATION(uid.m_uid))) {
+				TRACE_MESSAGE(TRACE_ERROR, "%s, %s (gen. 0x%x)", 
+					NIMBLE_UID_EXCEPTION_STRING(NIMBLE_UID_EXCEPTION_STALE),
+					 CHK_STR(nimble_uid::as_string(uid)), result->generation);
+				THROW_NIMBLE_UID_EXCEPTION_MESSAGE(NIMBLE_UID_EXCEPTION_STALE,
+					"%s (gen. 0x%x)", CHK_STR(nimble_uid::as_string(uid)), 
+					result->generation);
+			}
+
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", result);
-			return result;
+			return *result;
 		}
 
 		size_t 
@@ -327,8 +347,9 @@ namespace NIMBLE {
 			__out nimble_uid &uid
 			)
 		{
-			size_t result = REF_INITIAL;
-			std::set<nimble_uid>::iterator iter;
+			uint32_t index = UID_SLOT_INVALID;
+			size_t capacity, result = REF_INITIAL;
+			nimble_uid_slot slot = { 0, 0, UID_SLOT_INVALID };
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
@@ -339,21 +360,28 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			if(!m_surplus.empty()) {
-				iter = m_surplus.begin();
-				uid = *iter;
-				m_surplus.erase(iter);
-			} else if(m_next != UID_INVALID) {
-				uid = m_next.uid()++;
+			if(m_free != UID_SLOT_INVALID) {
+				index = m_free;
+				m_free = m_slot[index].next;
+			} else if(m_slot.size() <= UID_SLOT_MAX) {
+				capacity = m_slot.capacity();
+				index = m_slot.size();
+				m_slot.push_back(slot);
+				m_stats.resize(capacity * sizeof(nimble_uid_slot), 
+					m_slot.capacity() * sizeof(nimble_uid_slot));
 			} else {
 				TRACE_MESSAGE(TRACE_ERROR, "%s", 
 					NIMBLE_UID_EXCEPTION_STRING(NIMBLE_UID_EXCEPTION_RESOURCES));
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_RESOURCES);
 			}
 
+			m_slot[index].next = UID_SLOT_INVALID;
+			m_slot[index].reference = result;
+			uid = UID_MAKE(index, m_slot[index].generation);
+			++m_size;
+			m_stats.allocate();
 			TRACE_MESSAGE(TRACE_INFORMATION, "Generating new uid: %s", 
 				CHK_STR(uid.to_string(true)));
-			m_map.insert(std::pair<nimble_uid, size_t>(uid, result));
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
@@ -375,7 +403,7 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = ++find(uid)->second;
+			result = ++find(uid).reference;
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
@@ -394,9 +422,11 @@ namespace NIMBLE {
 			}
 
 			m_initialized = true;
-			m_map.clear();
-			m_next = UID_INITIAL;
-			m_surplus.clear();
+			m_free = UID_SLOT_INVALID;
+			m_size = 0;
+			m_slot.clear();
+			m_stats.reset();
+			m_stats.resize(0, m_slot.capacity() * sizeof(nimble_uid_slot));
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Uid component instance initialized");
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -440,7 +470,7 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = find(uid)->second;
+			result = find(uid).reference;
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
@@ -460,32 +490,45 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			result = m_map.size();
+			result = m_size;
 
 			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "res. %lu", result);
 			return result;
 		}
 
+		const nimble_stats &
+		_nimble_uid_factory::stats(void)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+			SERIALIZE_CALL_RECUR(m_lock);
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", &m_stats);
+			return m_stats;
+		}
+
 		std::string 
 		_nimble_uid_factory::to_string(
 			__in_opt bool verbose
 			)
 		{
+			uint32_t index;
 			std::stringstream result;
-			std::map<nimble_uid, size_t>::iterator iter;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 			SERIALIZE_CALL_RECUR(m_lock);
 
 			result << "(" << (m_initialized ? "INIT" : "UNINIT") << ") " << NIMBLE_UID_HEADER 
-				<< "[" << m_map.size() << "]";
+				<< "[" << m_size << "/" << m_slot.size() << "]";
 
 			if(verbose) {
 				result << " (" << VAL_AS_HEX(nimble_uid_factory_ptr, this) << ")";
 
-				for(iter = m_map.begin(); iter != m_map.end(); ++iter) {
-					result << std::endl << "--- " << nimble_uid::as_string(iter->first)
-						<< ", ref. " << iter->second;
+				for(index = 0; index < m_slot.size(); ++index) {
+
+					if(m_slot[index].reference >= REF_INITIAL) {
+						result << std::endl << "--- " << nimble_uid::as_string(
+							UID_MAKE(index, m_slot[index].generation))
+							<< ", ref. " << m_slot[index].reference;
+					}
 				}
 			}
 
@@ -505,9 +548,11 @@ namespace NIMBLE {
 				THROW_NIMBLE_UID_EXCEPTION(NIMBLE_UID_EXCEPTION_UNINITIALIZED);
 			}
 
-			m_map.clear();
-			m_next = UID_INITIAL;
-			m_surplus.clear();
+			m_free = UID_SLOT_INVALID;
+			m_size = 0;
+			m_slot.clear();
+			m_stats.reset();
+			m_stats.resize(0, m_slot.capacity() * sizeof(nimble_uid_slot));
 			m_initialized = false;
 			TRACE_MESSAGE(TRACE_INFORMATION, "%s", "Uid component instance uninitialized");
 
@@ -554,17 +599,33 @@ namespace NIMBLE {
 			TRACE_EXIT(TRACE_VERBOSE);
 		}
 
+		_nimble_uid_class::_nimble_uid_class(
+			__in _nimble_uid_class &&other
+			) :
+				nimble_uid(other)
+		{
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			other.m_uid = UID_INVALID;
+
+			TRACE_EXIT(TRACE_VERBOSE);
+		}
+
 		_nimble_uid_class::~_nimble_uid_class(void)
 		{
-			nimble_uid_factory_ptr fact = factory();
+			nimble_uid_factory_ptr fact = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
 
-			if(fact 
-					&& fact->is_initialized() 
-					&& fact->contains(*this)) {
-				fact->decrement_reference(*this);
-				m_uid = UID_INVALID;
+			if(m_uid != UID_INVALID) {
+
+				fact = factory();
+				if(fact 
+						&& fact->is_initialized() 
+						&& fact->contains(*this)) {
+					fact->decrement_reference(*this);
+					m_uid = UID_INVALID;
+				}
 			}
 
 			TRACE_EXIT(TRACE_VERBOSE);
@@ -578,7 +639,6 @@ namespace NIMBLE {
 			nimble_uid_factory_ptr fact = factory();
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(this != &other) {
 
@@ -601,6 +661,35 @@ namespace NIMBLE {
 			return *this;
 		}
 
+		_nimble_uid_class &
+		_nimble_uid_class::operator=(
+			__in _nimble_uid_class &&other
+			)
+		{
+			nimble_uid_factory_ptr fact = NULL;
+
+			TRACE_ENTRY(TRACE_VERBOSE);
+
+			if(this != &other) {
+
+				if(m_uid != UID_INVALID) {
+
+					fact = factory();
+					if(fact 
+							&& fact->is_initialized() 
+							&& fact->contains(*this)) {
+						fact->decrement_reference(*this);
+					}
+				}
+
+				m_uid = other.m_uid;
+				other.m_uid = UID_INVALID;
+			}
+
+			TRACE_EXIT_MESSAGE(TRACE_VERBOSE, "ptr. 0x%p", this);
+			return *this;
+		}
+
 		nimble_uid_factory_ptr 
 		_nimble_uid_class::factory(void)
 		{
@@ -608,7 +697,6 @@ namespace NIMBLE {
 			nimble_uid_factory_ptr result = NULL;
 
 			TRACE_ENTRY(TRACE_VERBOSE);
-			SERIALIZE_CALL_RECUR(m_lock);
 
 			if(nimble::is_allocated()) {
 
@@ -0,0 +1,76 @@
+/**
+ * libnimble
+ * Copyright (C) 2015 David Jolly
+ * ----------------------
+ *
+ * libnimble is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libnimble is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../lib/include/nimble.h"
+
+#define TRACE_CHROME_EXT ".json"
+#define TRACE_FLAG_CHROME "-c"
+
+int 
+main(
+	__in int argc,
+	__in const char **argv
+	)
+{
+	int iter = 1, result = 0;
+	std::vector<std::string> path;
+
+	if((argc > 1) && (std::string(argv[1]) == TRACE_FLAG_CHROME)) {
+		++iter;
+	}
+
+	if(argc <= iter) {
+		std::cerr << "Usage: " << argv[0] << " [" << TRACE_FLAG_CHROME << "] <trace file>..." 
+			<< std::endl;
+		return INVALID_TYPE(int);
+	}
+
+	try {
+
+		if(iter > 1) {
+
+			for(; iter < argc; ++iter) {
+				path.push_back(argv[iter]);
+			}
+
+			std::ofstream file((path.front() + TRACE_CHROME_EXT).c_str(), 
+				std::ios::out | std::ios::trunc);
+			if(!file) {
+				std::cerr << path.front() << TRACE_CHROME_EXT << ": cannot open" << std::endl;
+				return INVALID_TYPE(int);
+			}
+
+			nimble_trace::export_chrome(path, file);
+			std::cout << path.front() << TRACE_CHROME_EXT << std::endl;
+		} else {
+
+			for(; iter < argc; ++iter) {
+				nimble_trace::decode(argv[iter], std::cout);
+			}
+		}
+	} catch(nimble_exception &exc) {
+		std::cerr << exc.to_string(true) << std::endl;
+		result = INVALID_TYPE(int);
+	} catch(std::exception &exc) {
+		std::cerr << exc.what() << std::endl;
+		result = INVALID_TYPE(int);
+	}
+
+	return result;
+}